@@ -0,0 +1,194 @@
+#include "DaemonConfig.hpp"
+#include "Samplers.hpp"
+
+#include <charconv>
+#include <fstream>
+#include <optional>
+#include <sstream>
+
+namespace
+{
+std::string trim(const std::string &text)
+{
+    const auto first = text.find_first_not_of(" \t\r");
+    if (first == std::string::npos)
+    {
+        return "";
+    }
+    const auto last = text.find_last_not_of(" \t\r");
+    return text.substr(first, last - first + 1);
+}
+
+bool parseCount(const std::string &text, std::size_t &out)
+{
+    auto [end, ec] = std::from_chars(text.data(), text.data() + text.size(), out);
+    return ec == std::errc() && end == text.data() + text.size() && out > 0;
+}
+
+struct SinkSpec
+{
+    LogSinkType type;
+    std::string config;
+};
+
+std::optional<SinkSpec> parseSinkSpec(const std::string &spec)
+{
+    if (spec == "console")
+    {
+        return SinkSpec{LogSinkType::CONSOLE, ""};
+    }
+    const auto colon = spec.find(':');
+    if (colon == std::string::npos || colon + 1 == spec.size())
+    {
+        return std::nullopt;
+    }
+
+    const std::string kind = spec.substr(0, colon);
+    const std::string path = spec.substr(colon + 1);
+    if (kind == "file")
+    {
+        return SinkSpec{LogSinkType::FILE, path};
+    }
+    if (kind == "binary")
+    {
+        return SinkSpec{LogSinkType::BINARY, path};
+    }
+    if (kind == "timeseries")
+    {
+        return SinkSpec{LogSinkType::TIMESERIES, path};
+    }
+    return std::nullopt;
+}
+} // namespace
+
+std::expected<DaemonConfig, ConfigError> loadDaemonConfig(const std::string &path)
+{
+    std::ifstream file(path);
+    if (!file)
+    {
+        return std::unexpected(ConfigError{0, "cannot open " + path});
+    }
+
+    DaemonConfig config;
+    std::string line;
+    std::size_t lineNumber = 0;
+    while (std::getline(file, line))
+    {
+        ++lineNumber;
+        line = trim(line.substr(0, line.find('#')));
+        if (line.empty())
+        {
+            continue;
+        }
+
+        const auto equals = line.find('=');
+        if (equals == std::string::npos)
+        {
+            return std::unexpected(ConfigError{lineNumber, "expected 'key = value'"});
+        }
+        const std::string key = trim(line.substr(0, equals));
+        const std::string value = trim(line.substr(equals + 1));
+
+        if (key == "buffer_size")
+        {
+            if (!parseCount(value, config.bufferSize))
+            {
+                return std::unexpected(ConfigError{lineNumber, "buffer_size must be a positive integer"});
+            }
+        }
+        else if (key == "byte_budget")
+        {
+            if (!parseCount(value, config.byteBudget))
+            {
+                return std::unexpected(ConfigError{lineNumber, "byte_budget must be a positive integer"});
+            }
+        }
+        else if (key == "threads")
+        {
+            if (!parseCount(value, config.threads))
+            {
+                return std::unexpected(ConfigError{lineNumber, "threads must be a positive integer"});
+            }
+        }
+        else if (key == "max_threads")
+        {
+            if (!parseCount(value, config.maxThreads))
+            {
+                return std::unexpected(ConfigError{lineNumber, "max_threads must be a positive integer"});
+            }
+        }
+        else if (key == "metrics_socket")
+        {
+            config.metricsSocket = value;
+        }
+        else if (key == "sink")
+        {
+            if (!parseSinkSpec(value))
+            {
+                return std::unexpected(ConfigError{lineNumber, "unknown sink '" + value + "'"});
+            }
+            config.sinks.push_back(value);
+        }
+        else if (key == "source")
+        {
+            std::istringstream fields(value);
+            SamplerConfig source;
+            long long intervalMs = 0;
+            long long alertMs = 0;
+            fields >> source.kind >> intervalMs;
+            bool valid = fields && isSamplerKind(source.kind) && intervalMs > 0;
+            std::string flag;
+            while (valid && fields >> flag)
+            {
+                if (flag == "critical")
+                {
+                    source.critical = true;
+                }
+                else if (flag == "alert")
+                {
+                    valid = static_cast<bool>(fields >> alertMs) && alertMs > 0;
+                }
+                else
+                {
+                    valid = false;
+                }
+            }
+            if (!valid)
+            {
+                return std::unexpected(ConfigError{
+                    lineNumber, "expected 'source = <kind> <interval ms> [alert <interval ms>] [critical]'"});
+            }
+            source.alertInterval = std::chrono::milliseconds(alertMs);
+            source.interval = std::chrono::milliseconds(intervalMs);
+            config.sources.push_back(std::move(source));
+        }
+        else
+        {
+            return std::unexpected(ConfigError{lineNumber, "unknown key '" + key + "'"});
+        }
+    }
+
+    if (config.maxThreads != 0 && config.maxThreads < config.threads)
+    {
+        return std::unexpected(ConfigError{lineNumber, "max_threads must not be below threads"});
+    }
+    if (config.sinks.empty())
+    {
+        return std::unexpected(ConfigError{lineNumber, "no 'sink' configured"});
+    }
+    if (config.sources.empty())
+    {
+        return std::unexpected(ConfigError{lineNumber, "no 'source' configured"});
+    }
+    return config;
+}
+
+std::expected<std::shared_ptr<ILogSink>, SinkCreationError> makeSink(const std::string &spec)
+{
+    auto parsed = parseSinkSpec(spec);
+    if (!parsed)
+    {
+        return std::unexpected(SinkCreationError::UNKNOWN_SINK_TYPE);
+    }
+    return LogSinkFactory::create(parsed->type, parsed->config);
+}
@@ -0,0 +1,52 @@
+#pragma once
+
+#include "LogSinkFactory.hpp"
+
+#include <chrono>
+#include <expected>
+#include <memory>
+#include <string>
+#include <vector>
+
+// Telemetry daemon configuration, one "key = value" per line, '#' starts a comment:
+//
+//   buffer_size = 256
+//   byte_budget = 262144                (optional cap on buffered bytes)
+//   threads = 2
+//   max_threads = 8                     (optional; the pool grows up to this while writes queue)
+//   metrics_socket = /tmp/telemetry_metrics.sock
+//   sink = console | file:<path> | binary:<path> | timeseries:<path>
+//   source = <kind> <interval ms> [alert <interval ms>] [critical]   (kinds: see makeSampler)
+//
+// 'sink' and 'source' may repeat. At least one of each is required. With 'alert', a
+// source switches to the alert interval while its readings are WARNING/CRITICAL. Sources
+// not marked 'critical' sample less often while the logger reports backpressure.
+struct SamplerConfig
+{
+    std::string kind;
+    std::chrono::milliseconds interval;
+    std::chrono::milliseconds alertInterval{0};  // 0: same as 'interval'
+    bool critical = false;  // never throttled under backpressure
+};
+
+struct DaemonConfig
+{
+    std::size_t bufferSize = 256;
+    std::size_t threads = 2;
+    std::size_t maxThreads = 0;       // 0: fixed at 'threads'
+    std::size_t byteBudget = 0;       // 0: no byte cap
+    std::string metricsSocket;        // empty: no metrics endpoint
+    std::vector<std::string> sinks;   // sink specs, also used to diff on reload
+    std::vector<SamplerConfig> sources;
+};
+
+struct ConfigError
+{
+    std::size_t line;  // 0 when the file itself could not be read
+    std::string message;
+};
+
+std::expected<DaemonConfig, ConfigError> loadDaemonConfig(const std::string &path);
+
+// Creates the sink a "console" / "file:<path>" / "binary:<path>" / "timeseries:<path>" spec names
+std::expected<std::shared_ptr<ILogSink>, SinkCreationError> makeSink(const std::string &spec);
@@ -0,0 +1,121 @@
+#include "Samplers.hpp"
+#include "LogPolicies.hpp"
+#include "sources/FileTelemetrySourceImpl.hpp"
+#include "sources/LogManagerTelemetrySourceImpl.hpp"
+#include "sources/SomeIPTelemetryAdapter.hpp"
+
+#include <array>
+#include <sstream>
+#include <string_view>
+
+namespace
+{
+constexpr std::array<std::string_view, 8> KINDS = {
+    "cpu", "ram", "load", "queue", "drops", "flush", "backlog", "sink_latency"};
+
+template <typename Policy>
+std::unique_ptr<Sampler> selfSampler(const LogManager &logger, LoggerMetric metric)
+{
+    return std::make_unique<SourceSampler<Policy>>(
+        std::make_unique<LogManagerTelemetrySourceImpl>(logger, metric), passThrough);
+}
+} // namespace
+
+std::optional<std::string> extractCpuTicks(const std::string &raw)
+{
+    std::istringstream iss(raw);
+    std::string label;
+    long long userTicks = 0;
+
+    iss >> label >> userTicks;
+    if (label != "cpu" || !iss)
+    {
+        return std::nullopt;
+    }
+    return std::to_string(userTicks);
+}
+
+std::optional<std::string> extractMemAvailableGB(const std::string &raw)
+{
+    std::istringstream memStream(raw);
+    std::string line;
+
+    while (std::getline(memStream, line))
+    {
+        if (line.rfind("MemAvailable:", 0) == 0)
+        {
+            std::istringstream lineStream(line);
+            std::string label;
+            long long memKB = 0;
+
+            lineStream >> label >> memKB;
+            if (!lineStream)
+            {
+                return std::nullopt;
+            }
+            return std::to_string(memKB / (1024.0 * 1024.0));
+        }
+    }
+    return std::nullopt;
+}
+
+std::optional<std::string> passThrough(const std::string &raw)
+{
+    if (raw.empty())
+    {
+        return std::nullopt;
+    }
+    return raw;
+}
+
+std::unique_ptr<Sampler> makeSampler(const std::string &kind, const LogManager &logger)
+{
+    if (kind == "cpu")
+    {
+        return std::make_unique<SourceSampler<CpuPolicy>>(
+            std::make_unique<FileTelemetrySourceImpl>("/proc/stat"), extractCpuTicks);
+    }
+    if (kind == "ram")
+    {
+        return std::make_unique<SourceSampler<RamPolicy>>(
+            std::make_unique<FileTelemetrySourceImpl>("/proc/meminfo"), extractMemAvailableGB);
+    }
+    if (kind == "load")
+    {
+        return std::make_unique<SourceSampler<LoadPolicy>>(
+            std::make_unique<SomeIPTelemetryAdapter>(), passThrough);
+    }
+    if (kind == "queue")
+    {
+        return selfSampler<LogQueuePolicy>(logger, LoggerMetric::QUEUE_FILL);
+    }
+    if (kind == "drops")
+    {
+        return selfSampler<LogDropPolicy>(logger, LoggerMetric::DROPS);
+    }
+    if (kind == "flush")
+    {
+        return selfSampler<LogFlushPolicy>(logger, LoggerMetric::FLUSH_DURATION);
+    }
+    if (kind == "backlog")
+    {
+        return selfSampler<LogBacklogPolicy>(logger, LoggerMetric::POOL_BACKLOG);
+    }
+    if (kind == "sink_latency")
+    {
+        return selfSampler<LogSinkLatencyPolicy>(logger, LoggerMetric::SINK_LATENCY);
+    }
+    return nullptr;
+}
+
+bool isSamplerKind(const std::string &kind)
+{
+    for (auto known : KINDS)
+    {
+        if (kind == known)
+        {
+            return true;
+        }
+    }
+    return false;
+}
@@ -0,0 +1,65 @@
+#pragma once
+
+#include "LogFormatter.hpp"
+#include "LogManager.hpp"
+#include "interfaces/ITelemetrySource.hpp"
+
+#include <memory>
+#include <optional>
+#include <string>
+
+// One telemetry source plus the formatter that turns its readings into LogMessages
+class Sampler
+{
+public:
+    virtual ~Sampler() = default;
+    virtual bool open() = 0;
+    virtual std::optional<LogMessage> sample() = 0;
+};
+
+// Pulls the number the formatter expects out of a raw reading
+using Extractor = std::optional<std::string> (*)(const std::string &raw);
+
+std::optional<std::string> extractCpuTicks(const std::string &raw);       // /proc/stat
+std::optional<std::string> extractMemAvailableGB(const std::string &raw); // /proc/meminfo
+std::optional<std::string> passThrough(const std::string &raw);
+
+template <typename Policy>
+class SourceSampler : public Sampler
+{
+private:
+    std::unique_ptr<ITelemetrySource> source;
+    Extractor extract;
+    LogFormatter<Policy> formatter;
+    std::string raw;  // reused between reads
+
+public:
+    SourceSampler(std::unique_ptr<ITelemetrySource> source, Extractor extract)
+        : source(std::move(source)), extract(extract)
+    {
+    }
+
+    bool open() override
+    {
+        return source->openSource();
+    }
+
+    std::optional<LogMessage> sample() override
+    {
+        if (!source->readSource(raw))
+        {
+            return std::nullopt;
+        }
+        auto value = extract(raw);
+        if (!value)
+        {
+            return std::nullopt;
+        }
+        return formatter.formatDataToLogMsg(*value);
+    }
+};
+
+// Kinds: cpu, ram, load (SomeIP), queue, drops, flush, backlog, sink_latency.
+// The last five read the logger's own health. Returns nullptr for an unknown kind.
+std::unique_ptr<Sampler> makeSampler(const std::string &kind, const LogManager &logger);
+bool isSamplerKind(const std::string &kind);
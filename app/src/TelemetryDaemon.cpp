@@ -0,0 +1,303 @@
+#include "TelemetryDaemon.hpp"
+#include "LogManagerBuilder.hpp"
+#include "utils/Trace.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <iostream>
+#include <magic_enum.hpp>
+
+TelemetryDaemon::TelemetryDaemon(std::string configPath)
+    : configPath(std::move(configPath))
+{
+    sigemptyset(&signals);
+    sigaddset(&signals, SIGTERM);
+    sigaddset(&signals, SIGINT);
+    sigaddset(&signals, SIGHUP);
+    sigaddset(&signals, SIGUSR1);
+}
+
+int TelemetryDaemon::run()
+{
+    // Block before any thread exists so pool workers inherit the mask and the
+    // signals are only ever consumed by sigtimedwait() below
+    if (pthread_sigmask(SIG_BLOCK, &signals, nullptr) != 0)
+    {
+        std::cerr << "telemetry daemon: cannot block signals\n";
+        return 1;
+    }
+    if (!start())
+    {
+        return 1;
+    }
+
+    while (true)
+    {
+        const auto wait = std::max(Clock::duration::zero(), nextDeadline() - Clock::now());
+        const auto waitNs = std::chrono::duration_cast<std::chrono::nanoseconds>(wait).count();
+        timespec timeout{static_cast<time_t>(waitNs / 1000000000), static_cast<long>(waitNs % 1000000000)};
+
+        siginfo_t info{};
+        const int signal = sigtimedwait(&signals, &info, &timeout);
+        if (signal == SIGHUP)
+        {
+            reload();
+        }
+        else if (signal == SIGUSR1)
+        {
+            dumpTrace();
+        }
+        else if (signal == SIGTERM || signal == SIGINT)
+        {
+            break;
+        }
+        else if (signal < 0 && errno == EAGAIN)
+        {
+            runDue(Clock::now());
+        }
+    }
+
+    std::cerr << "telemetry daemon: draining\n";
+    if (metrics)
+    {
+        metrics->stop();
+    }
+    if (!logger->flushAndWait(Clock::now() + DRAIN_TIMEOUT))
+    {
+        std::cerr << "telemetry daemon: timed out waiting for log sinks to finish\n";
+    }
+#ifdef LOGGING_ENABLE_TRACING
+    dumpTrace();
+#endif
+    return 0;
+}
+
+void TelemetryDaemon::dumpTrace() const
+{
+    if (trace::dumpChromeTrace(TRACE_PATH))
+    {
+        std::cerr << "telemetry daemon: pipeline trace written to " << TRACE_PATH << "\n";
+    }
+    else
+    {
+        std::cerr << "telemetry daemon: no pipeline trace (not built with tracing, or " << TRACE_PATH
+                  << " not writable)\n";
+    }
+}
+
+bool TelemetryDaemon::start()
+{
+    auto loaded = loadDaemonConfig(configPath);
+    if (!loaded)
+    {
+        std::cerr << "telemetry daemon: " << configPath << ":" << loaded.error().line << ": "
+                  << loaded.error().message << "\n";
+        return false;
+    }
+    config = std::move(*loaded);
+
+    LogManagerBuilder builder;
+    builder.withBufferSize(config.bufferSize).withthreadPoolSize(config.threads);
+    if (config.maxThreads != 0)
+    {
+        builder.withElasticThreadPool(config.threads, config.maxThreads);
+    }
+    if (config.byteBudget != 0)
+    {
+        builder.withByteBudget(config.byteBudget);
+    }
+    for (const auto &spec : config.sinks)
+    {
+        auto sink = makeSink(spec);
+        if (!sink)
+        {
+            std::cerr << "telemetry daemon: sink '" << spec << "': " << magic_enum::enum_name(sink.error()) << "\n";
+            return false;
+        }
+        sinks.emplace(spec, *sink);
+        builder.withSink(*sink);
+    }
+
+    auto built = builder.tryBuild();
+    if (!built)
+    {
+        std::cerr << "telemetry daemon: " << magic_enum::enum_name(built.error()) << "\n";
+        return false;
+    }
+    logger = std::move(*built);
+    logger->subscribePressure([this](const LogPressure &current) {
+        pressure.store(current.level, std::memory_order_relaxed);
+    });
+
+    applyMetrics(config);
+    applySources(config);
+    std::cerr << "telemetry daemon: running with " << sinks.size() << " sinks, "
+              << schedule.size() << " sources\n";
+    return true;
+}
+
+void TelemetryDaemon::reload()
+{
+    auto loaded = loadDaemonConfig(configPath);
+    if (!loaded)
+    {
+        std::cerr << "telemetry daemon: reload failed, keeping current config: " << configPath << ":"
+                  << loaded.error().line << ": " << loaded.error().message << "\n";
+        return;
+    }
+
+    DaemonConfig next = std::move(*loaded);
+    if (next.byteBudget != config.byteBudget)
+    {
+        std::cerr << "telemetry daemon: byte_budget changes take effect on restart\n";
+        next.byteBudget = config.byteBudget;
+    }
+    if (next.bufferSize != config.bufferSize)
+    {
+        logger->resizeBuffer(next.bufferSize);
+    }
+    if (next.threads != config.threads || next.maxThreads != config.maxThreads)
+    {
+        logger->setWorkerBounds(ThreadPoolBounds{next.threads, std::max(next.threads, next.maxThreads)});
+    }
+
+    applySinks(next);
+    applyMetrics(next);
+    applySources(next);
+    config = std::move(next);
+    std::cerr << "telemetry daemon: reloaded, " << sinks.size() << " sinks, "
+              << schedule.size() << " sources\n";
+}
+
+void TelemetryDaemon::applySinks(const DaemonConfig &next)
+{
+    // Add before removing so messages always have somewhere to go
+    for (const auto &spec : next.sinks)
+    {
+        if (sinks.contains(spec))
+        {
+            continue;
+        }
+        auto sink = makeSink(spec);
+        if (!sink)
+        {
+            std::cerr << "telemetry daemon: sink '" << spec << "': " << magic_enum::enum_name(sink.error()) << "\n";
+            continue;
+        }
+        logger->addSink(*sink);
+        sinks.emplace(spec, *sink);
+    }
+
+    for (auto it = sinks.begin(); it != sinks.end();)
+    {
+        if (std::find(next.sinks.begin(), next.sinks.end(), it->first) == next.sinks.end())
+        {
+            logger->removeSink(it->second);  // waits for its queued writes
+            it = sinks.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+}
+
+void TelemetryDaemon::applyMetrics(const DaemonConfig &next)
+{
+    if (metrics && next.metricsSocket == config.metricsSocket)
+    {
+        return;
+    }
+    metrics.reset();
+    if (next.metricsSocket.empty())
+    {
+        return;
+    }
+
+    metrics = std::make_unique<MetricsServer>(*logger, next.metricsSocket);
+    if (!metrics->start())
+    {
+        std::cerr << "telemetry daemon: metrics endpoint " << next.metricsSocket << " not available\n";
+        metrics.reset();
+    }
+}
+
+void TelemetryDaemon::applySources(const DaemonConfig &next)
+{
+    schedule.clear();
+    const auto now = Clock::now();
+    for (const auto &source : next.sources)
+    {
+        auto sampler = makeSampler(source.kind, *logger);
+        if (!sampler || !sampler->open())
+        {
+            std::cerr << "telemetry daemon: source '" << source.kind << "' not available, skipped\n";
+            continue;
+        }
+        const auto alertInterval = source.alertInterval.count() > 0 ? source.alertInterval : source.interval;
+        schedule.push_back(Scheduled{source.kind, std::move(sampler), source.interval, alertInterval,
+                                     source.critical, now});
+    }
+}
+
+TelemetryDaemon::Clock::time_point TelemetryDaemon::nextDeadline() const
+{
+    if (schedule.empty())
+    {
+        return Clock::now() + std::chrono::hours(1);  // nothing to sample; only signals matter
+    }
+    auto earliest = schedule.front().due;
+    for (const auto &entry : schedule)
+    {
+        earliest = std::min(earliest, entry.due);
+    }
+    return earliest;
+}
+
+void TelemetryDaemon::runDue(Clock::time_point now)
+{
+    const PressureLevel level = pressure.load(std::memory_order_relaxed);
+    if (level != reportedPressure)
+    {
+        std::cerr << "telemetry daemon: logger pressure " << magic_enum::enum_name(level) << "\n";
+        reportedPressure = level;
+    }
+    const int throttle = level == PressureLevel::HIGH ? 4 : level == PressureLevel::ELEVATED ? 2 : 1;
+
+    bool logged = false;
+    for (auto &entry : schedule)
+    {
+        if (entry.due > now)
+        {
+            continue;
+        }
+        if (auto msg = entry.sampler->sample())
+        {
+            // The policy's severity picks the rate: fast while anything is off, back to
+            // normal only after the readings stayed INFO for a while
+            if (msg->getSeverity() != SeverityLvl::INFO)
+            {
+                entry.alertHold = ALERT_HOLD_SAMPLES;
+            }
+            else if (entry.alertHold > 0)
+            {
+                --entry.alertHold;
+            }
+            logger->log(std::move(*msg));
+            logged = true;
+        }
+
+        // Fixed-rate deadlines; after a stall, skip missed ticks instead of bursting
+        const auto base = entry.alertHold > 0 ? entry.alertInterval : entry.interval;
+        const auto interval = entry.critical ? base : base * throttle;
+        entry.due += interval;
+        if (entry.due <= now)
+        {
+            entry.due = now + interval;
+        }
+    }
+    if (logged)
+    {
+        logger->flush();
+    }
+}
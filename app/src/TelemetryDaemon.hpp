@@ -0,0 +1,70 @@
+#pragma once
+
+#include "DaemonConfig.hpp"
+#include "Samplers.hpp"
+#include "LogManager.hpp"
+#include "core/MetricsServer.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <memory>
+#include <signal.h>
+#include <string>
+#include <vector>
+
+// Long-running mode of the app: sources and sinks come from a config file, sampling is
+// driven by per-source deadlines, and the lifecycle by signals:
+//   SIGTERM / SIGINT  drain the pipeline and exit
+//   SIGHUP            reload the config (sinks and sources are swapped in place)
+//   SIGUSR1           write the pipeline trace to TRACE_PATH (builds with tracing only)
+// Runs in the foreground; leave detaching and restarts to systemd or another supervisor.
+// A source with an alert interval samples at that rate while its readings are
+// WARNING/CRITICAL, and returns to its normal interval after ALERT_HOLD_SAMPLES INFO
+// readings in a row. While the logger reports backpressure, non-critical sources stretch their interval
+// (x2 ELEVATED, x4 HIGH) so load is shed where it is produced.
+class TelemetryDaemon
+{
+private:
+    using Clock = std::chrono::steady_clock;
+
+    static constexpr std::chrono::seconds DRAIN_TIMEOUT{5};
+    static constexpr unsigned ALERT_HOLD_SAMPLES = 10;
+    static constexpr const char *TRACE_PATH = "telemetry_trace.json";  // also written on drain
+
+    struct Scheduled
+    {
+        std::string kind;
+        std::unique_ptr<Sampler> sampler;
+        std::chrono::milliseconds interval;
+        std::chrono::milliseconds alertInterval;
+        bool critical;
+        Clock::time_point due;
+        unsigned alertHold = 0;  // > 0 while sampling at the alert interval
+    };
+
+    std::string configPath;
+    DaemonConfig config;
+    std::unique_ptr<LogManager> logger;
+    std::unique_ptr<MetricsServer> metrics;
+    std::map<std::string, std::shared_ptr<ILogSink>> sinks;  // keyed by sink spec
+    std::vector<Scheduled> schedule;
+    sigset_t signals;
+    std::atomic<PressureLevel> pressure{PressureLevel::NORMAL};  // set from the logger's callback
+    PressureLevel reportedPressure = PressureLevel::NORMAL;
+
+    bool start();
+    void applySinks(const DaemonConfig &next);
+    void applySources(const DaemonConfig &next);
+    void applyMetrics(const DaemonConfig &next);
+    void reload();
+    void runDue(Clock::time_point now);
+    void dumpTrace() const;
+    [[nodiscard]] Clock::time_point nextDeadline() const;
+
+public:
+    explicit TelemetryDaemon(std::string configPath);
+
+    // Blocks until SIGTERM/SIGINT; returns the process exit code
+    int run();
+};
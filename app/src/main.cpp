@@ -1,16 +1,53 @@
 #include "LogManagerBuilder.hpp"
-#include "LogFormatter.hpp"
-#include "LogPolicies.hpp"
-#include "sources/FileTelemetrySourceImpl.hpp"
-#include "sources/SomeIPTelemetryAdapter.hpp"
+#include "Samplers.hpp"
+#include "TelemetryDaemon.hpp"
+#include "core/MetricsServer.hpp"
+#include "utils/Trace.hpp"
 
 #include <iostream>
 #include <thread>
 #include <chrono>
-#include <sstream>
+#include <string>
+#include <vector>
 
-int main()
+namespace
 {
+void printUsage(const char *argv0)
+{
+    std::cerr << "Usage: " << argv0 << " [--daemon [--config PATH]]\n"
+              << "  (no args)   five-iteration demo\n"
+              << "  --daemon    run until SIGTERM; SIGHUP reloads the config\n"
+              << "  --config    daemon config (default: config/telemetry-daemon.conf)\n";
+}
+} // namespace
+
+int main(int argc, char *argv[])
+{
+    bool daemonMode = false;
+    std::string configPath = "config/telemetry-daemon.conf";
+    for (int i = 1; i < argc; ++i)
+    {
+        std::string arg = argv[i];
+        if (arg == "--daemon")
+        {
+            daemonMode = true;
+        }
+        else if (arg == "--config" && i + 1 < argc)
+        {
+            configPath = argv[++i];
+        }
+        else
+        {
+            printUsage(argv[0]);
+            return 1;
+        }
+    }
+
+    if (daemonMode)
+    {
+        return TelemetryDaemon(configPath).run();
+    }
+
     // ===== Build LogManager using Builder =====
     auto result = LogManagerBuilder()
                       .withConsoleSink()
@@ -27,34 +64,43 @@ int main()
 
     auto logger = std::move(result.value());
 
-    // ===== Setup Telemetry Sources =====
+    // Prometheus-text snapshot on a local socket: socat - UNIX-CONNECT:/tmp/telemetry_metrics.sock
+    MetricsServer metricsServer(*logger, "/tmp/telemetry_metrics.sock");
+    if (!metricsServer.start())
+    {
+        std::cerr << "Metrics endpoint not available\n";
+    }
+
+    // ===== Setup Telemetry Sources + Formatters (Policy-based) =====
     // Local Linux /proc files
-    FileTelemetrySourceImpl cpuSource("/proc/stat");
-    FileTelemetrySourceImpl memSource("/proc/meminfo");
-    
+    auto cpuSampler = makeSampler("cpu", *logger);
+    auto ramSampler = makeSampler("ram", *logger);
+
     // Remote SomeIP telemetry (vsomeip-based)
-    SomeIPTelemetryAdapter someipSource;
+    auto loadSampler = makeSampler("load", *logger);
     bool someipAvailable = false;
 
-    // ===== Setup Formatters (Policy-based) =====
-    LogFormatter<CpuPolicy> cpuFormatter;
-    LogFormatter<RamPolicy> ramFormatter;
-    LogFormatter<LoadPolicy> loadFormatter;  // For SomeIP load data
+    // LogManager self-telemetry (queue fill and sink write latency)
+    auto queueSampler = makeSampler("queue", *logger);
+    auto sinkLatencySampler = makeSampler("sink_latency", *logger);
 
     // ===== Open Sources =====
-    if (!cpuSource.openSource())
+    if (!cpuSampler->open())
     {
         std::cerr << "Failed to open /proc/stat\n";
         return 1;
     }
-    if (!memSource.openSource())
+    if (!ramSampler->open())
     {
         std::cerr << "Failed to open /proc/meminfo\n";
         return 1;
     }
-    
+
+    queueSampler->open();
+    sinkLatencySampler->open();
+
     // SomeIP is optional - don't fail if server is not running
-    if (someipSource.openSource())
+    if (loadSampler->open())
     {
         someipAvailable = true;
         std::cout << "SomeIP telemetry source connected.\n";
@@ -71,60 +117,23 @@ int main()
     }
     std::cout << "...\n\n";
 
+    std::vector<Sampler *> samplers = {cpuSampler.get(), ramSampler.get()};
+    if (someipAvailable)
+    {
+        samplers.push_back(loadSampler.get());
+    }
+    // Log the logger's own health through the same pipeline
+    samplers.push_back(queueSampler.get());
+    samplers.push_back(sinkLatencySampler.get());
+
     // ===== Main Loop (single-threaded reads, internal pool handles writes) =====
     for (int i = 0; i < 5; ++i)
     {
-        std::string rawData;
-
-        // Read and log CPU telemetry
-        if (cpuSource.readSource(rawData))
-        {
-            std::istringstream iss(rawData);
-            std::string label;
-            long long userTicks;
-
-            iss >> label >> userTicks;
-            if (label == "cpu" && iss)
-            {
-                if (auto msg = cpuFormatter.formatDataToLogMsg(std::to_string(userTicks)))
-                {
-                    logger->log(msg.value());
-                }
-            }
-        }
-
-        // Read and log RAM telemetry
-        if (memSource.readSource(rawData))
-        {
-            std::istringstream memStream(rawData);
-            std::string line;
-
-            while (std::getline(memStream, line))
-            {
-                if (line.rfind("MemAvailable:", 0) == 0)
-                {
-                    std::istringstream lineStream(line);
-                    std::string label;
-                    long long memKB;
-
-                    lineStream >> label >> memKB;
-                    double memGB = memKB / (1024.0 * 1024.0);
-
-                    if (auto msg = ramFormatter.formatDataToLogMsg(std::to_string(memGB)))
-                    {
-                        logger->log(msg.value());
-                    }
-                    break;
-                }
-            }
-        }
-        
-        // Read and log SomeIP telemetry (remote load percentage)
-        if (someipAvailable && someipSource.readSource(rawData))
+        for (auto *sampler : samplers)
         {
-            if (auto msg = loadFormatter.formatDataToLogMsg(rawData))
+            if (auto msg = sampler->sample())
             {
-                logger->log(msg.value());
+                logger->log(std::move(msg.value()));
             }
         }
 
@@ -137,6 +146,18 @@ int main()
         }
     }
 
+    // Wait until the sinks have written everything instead of relying on pool teardown
+    if (!logger->flushAndWait(std::chrono::steady_clock::now() + std::chrono::seconds(2)))
+    {
+        std::cerr << "Timed out waiting for log sinks to finish\n";
+    }
+
+    // No-op unless built with LOGGING_ENABLE_TRACING
+    if (trace::dumpChromeTrace("telemetry_trace.json"))
+    {
+        std::cout << "Pipeline trace written to telemetry_trace.json\n";
+    }
+
     std::cout << "\n=== Complete ===\n";
     return 0;
 }
\ No newline at end of file
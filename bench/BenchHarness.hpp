@@ -0,0 +1,185 @@
+#pragma once
+
+// Minimal benchmark harness: runs named cases, collects results and emits them
+// as JSON so runs can be compared release over release.
+//
+//   logging_bench [--filter <substring>] [--out <file.json>]
+//
+// Human-readable progress goes to stderr, JSON to stdout (or --out).
+
+#include "interfaces/ILogSink.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <ctime>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace bench
+{
+using Clock = std::chrono::steady_clock;
+
+struct BenchResult
+{
+    std::string name;
+    std::size_t threads = 1;
+    std::uint64_t operations = 0;
+    std::chrono::nanoseconds elapsed{0};
+    std::vector<std::pair<std::string, double>> metrics;  // extra values, e.g. percentiles
+
+    [[nodiscard]] double nsPerOp() const
+    {
+        return operations ? static_cast<double>(elapsed.count()) / static_cast<double>(operations) : 0.0;
+    }
+
+    [[nodiscard]] double opsPerSec() const
+    {
+        return elapsed.count() ? static_cast<double>(operations) * 1e9 / static_cast<double>(elapsed.count()) : 0.0;
+    }
+};
+
+class BenchReport
+{
+private:
+    std::vector<BenchResult> results;
+    std::string filter;
+    std::string outPath;
+
+    static std::string escape(std::string_view text)
+    {
+        std::string out;
+        for (char c : text)
+        {
+            if (c == '"' || c == '\\')
+            {
+                out += '\\';
+            }
+            out += c;
+        }
+        return out;
+    }
+
+public:
+    BenchReport(int argc, char **argv)
+    {
+        for (int i = 1; i + 1 < argc; ++i)
+        {
+            std::string_view flag = argv[i];
+            if (flag == "--filter")
+            {
+                filter = argv[++i];
+            }
+            else if (flag == "--out")
+            {
+                outPath = argv[++i];
+            }
+        }
+    }
+
+    [[nodiscard]] bool enabled(std::string_view name) const
+    {
+        return filter.empty() || name.find(filter) != std::string_view::npos;
+    }
+
+    void add(BenchResult result)
+    {
+        std::cerr << result.name << " threads=" << result.threads
+                  << " ops=" << result.operations
+                  << " ns/op=" << result.nsPerOp()
+                  << " ops/s=" << result.opsPerSec();
+        for (const auto &[key, value] : result.metrics)
+        {
+            std::cerr << ' ' << key << '=' << value;
+        }
+        std::cerr << '\n';
+        results.push_back(std::move(result));
+    }
+
+    [[nodiscard]] std::string toJson() const
+    {
+        std::ostringstream json;
+        json << "{\n  \"context\": {\"timestamp\": " << std::time(nullptr)
+             << ", \"hardware_threads\": " << std::thread::hardware_concurrency() << "},\n"
+             << "  \"benchmarks\": [";
+        for (std::size_t i = 0; i < results.size(); ++i)
+        {
+            const auto &r = results[i];
+            json << (i ? ",\n" : "\n")
+                 << "    {\"name\": \"" << escape(r.name) << "\", \"threads\": " << r.threads
+                 << ", \"operations\": " << r.operations
+                 << ", \"elapsed_ns\": " << r.elapsed.count()
+                 << ", \"ns_per_op\": " << r.nsPerOp()
+                 << ", \"ops_per_sec\": " << r.opsPerSec();
+            for (const auto &[key, value] : r.metrics)
+            {
+                json << ", \"" << escape(key) << "\": " << value;
+            }
+            json << '}';
+        }
+        json << "\n  ]\n}\n";
+        return json.str();
+    }
+
+    void write() const
+    {
+        if (outPath.empty())
+        {
+            std::cout << toJson();
+            return;
+        }
+        std::ofstream(outPath) << toJson();
+    }
+};
+
+// Sorts in place; p in [0, 1]
+inline double percentile(std::vector<std::int64_t> &samples, double p)
+{
+    if (samples.empty())
+    {
+        return 0.0;
+    }
+    std::sort(samples.begin(), samples.end());
+    auto index = static_cast<std::size_t>(p * static_cast<double>(samples.size() - 1));
+    return static_cast<double>(samples[index]);
+}
+
+inline std::int64_t nowNs()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now().time_since_epoch()).count();
+}
+
+// CPU time used by all threads of the process so far; the difference over a run
+// shows what a wait strategy costs while it keeps latency down
+inline std::chrono::nanoseconds processCpuTime()
+{
+    timespec now{};
+    clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &now);
+    return std::chrono::seconds(now.tv_sec) + std::chrono::nanoseconds(now.tv_nsec);
+}
+
+// Bursty hand-off traffic: BURST items back to back, then an idle gap long enough
+// for a parking waiter to fall asleep
+inline constexpr std::size_t HANDOFF_BURST = 8;
+inline constexpr std::size_t HANDOFF_ITEMS = 20000;
+inline constexpr std::chrono::microseconds HANDOFF_GAP{100};
+
+// Discards everything: isolates LogManager overhead from sink I/O
+class NullSink : public ILogSink
+{
+public:
+    void write(const LogMessage &) override {}
+};
+
+// Suites, one per translation unit
+void runRingBufferBenchmarks(BenchReport &report);
+void runThreadPoolBenchmarks(BenchReport &report);
+void runFormatterBenchmarks(BenchReport &report);
+void runLogManagerBenchmarks(BenchReport &report);
+} // namespace bench
@@ -0,0 +1,14 @@
+#include "BenchHarness.hpp"
+
+int main(int argc, char **argv)
+{
+    bench::BenchReport report(argc, argv);
+
+    bench::runRingBufferBenchmarks(report);
+    bench::runThreadPoolBenchmarks(report);
+    bench::runFormatterBenchmarks(report);
+    bench::runLogManagerBenchmarks(report);
+
+    report.write();
+    return 0;
+}
@@ -0,0 +1,143 @@
+// End-to-end latency of CRITICAL messages while the pool is flooded with INFO.
+//
+// A flood thread keeps a deep INFO backlog on the ThreadPool while a second thread
+// logs one CRITICAL message every couple of milliseconds. The sink records the time
+// from log() to write() per severity, so the priority lane shows up as a CRITICAL
+// tail that stays flat while the INFO tail grows with the backlog.
+//
+//   bench_critical_latency [--seconds N] [--threads N] [--backlog N] [--write-cost-us N] [--out file.json]
+
+#include "BenchHarness.hpp"
+#include "LogManager.hpp"
+
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+
+namespace
+{
+using bench::Clock;
+using bench::nowNs;
+
+// Records log()->write() latency; the send time travels in the payload
+class LatencySink : public ILogSink
+{
+private:
+    std::chrono::microseconds writeCost;
+    std::mutex samplesMutex;
+    std::vector<std::int64_t> infoSamples;
+    std::vector<std::int64_t> criticalSamples;
+
+public:
+    std::atomic<std::size_t> written{0};
+
+    explicit LatencySink(std::chrono::microseconds cost) : writeCost(cost) {}
+
+    void write(const LogMessage &msg) override
+    {
+        std::int64_t latency = nowNs() - std::stoll(msg.getPayload());
+
+        // Simulate sink I/O cost without sleeping (sleep granularity would dominate)
+        auto until = Clock::now() + writeCost;
+        while (Clock::now() < until)
+        {
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(samplesMutex);
+            auto &samples = msg.getSeverity() == SeverityLvl::CRITICAL ? criticalSamples : infoSamples;
+            samples.push_back(latency);
+        }
+        written.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    std::vector<std::int64_t> take(SeverityLvl severity)
+    {
+        std::lock_guard<std::mutex> lock(samplesMutex);
+        return std::move(severity == SeverityLvl::CRITICAL ? criticalSamples : infoSamples);
+    }
+};
+
+bench::BenchResult latencyResult(const char *name, std::vector<std::int64_t> samples,
+                                 std::size_t threads, std::chrono::nanoseconds elapsed)
+{
+    const auto count = samples.size();
+    return {name, threads, count, elapsed,
+            {{"p50_us", bench::percentile(samples, 0.50) / 1000.0},
+             {"p99_us", bench::percentile(samples, 0.99) / 1000.0},
+             {"p999_us", bench::percentile(samples, 0.999) / 1000.0},
+             {"max_us", samples.empty() ? 0.0 : static_cast<double>(samples.back()) / 1000.0}}};
+}
+
+std::size_t argOr(int argc, char **argv, const char *flag, std::size_t fallback)
+{
+    for (int i = 1; i + 1 < argc; ++i)
+    {
+        if (std::strcmp(argv[i], flag) == 0)
+        {
+            return static_cast<std::size_t>(std::strtoull(argv[i + 1], nullptr, 10));
+        }
+    }
+    return fallback;
+}
+} // namespace
+
+int main(int argc, char **argv)
+{
+    bench::BenchReport report(argc, argv);
+    const auto seconds = argOr(argc, argv, "--seconds", 3);
+    const auto threads = argOr(argc, argv, "--threads", 2);
+    const auto backlog = argOr(argc, argv, "--backlog", 20000);
+    const auto writeCostUs = argOr(argc, argv, "--write-cost-us", 5);
+
+    auto sink = std::make_shared<LatencySink>(std::chrono::microseconds(writeCostUs));
+    LogManager manager(1024, threads);
+    manager.addSink(sink);
+
+    std::atomic<bool> running{true};
+    std::atomic<std::size_t> logged{0};
+
+    std::thread flood([&]() {
+        while (running.load(std::memory_order_relaxed))
+        {
+            // Keep the pool saturated without letting its queue grow without bound
+            if (logged.load(std::memory_order_relaxed) - sink->written.load(std::memory_order_relaxed) > backlog)
+            {
+                manager.flush();
+                std::this_thread::yield();
+                continue;
+            }
+            manager.log(LogMessage(TelemetrySrc::CPU, SeverityLvl::INFO, "bench", std::to_string(nowNs())));
+            logged.fetch_add(1, std::memory_order_relaxed);
+        }
+    });
+
+    std::thread critical([&]() {
+        while (running.load(std::memory_order_relaxed))
+        {
+            manager.log(LogMessage(TelemetrySrc::CPU, SeverityLvl::CRITICAL, "bench", std::to_string(nowNs())));
+            logged.fetch_add(1, std::memory_order_relaxed);
+            std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        }
+    });
+
+    auto start = Clock::now();
+    std::this_thread::sleep_for(std::chrono::seconds(seconds));
+    running = false;
+    flood.join();
+    critical.join();
+    manager.flush();
+
+    // Let the backlog drain before reading the samples
+    while (sink->written.load() < logged.load())
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+
+    auto elapsed = Clock::now() - start;
+    report.add(latencyResult("CriticalLatency/INFO", sink->take(SeverityLvl::INFO), threads, elapsed));
+    report.add(latencyResult("CriticalLatency/CRITICAL", sink->take(SeverityLvl::CRITICAL), threads, elapsed));
+    report.write();
+    return 0;
+}
@@ -0,0 +1,48 @@
+#include "BenchHarness.hpp"
+#include "LogFormatter.hpp"
+#include "LogPolicies.hpp"
+
+#include <magic_enum.hpp>
+
+namespace bench
+{
+namespace
+{
+constexpr std::uint64_t ITERATIONS = 200000;
+
+// Full formatDataToLogMsg(): parse, inferSeverity, timestamp, description
+template <typename Policy>
+BenchResult formatCost()
+{
+    LogFormatter<Policy> formatter;
+    // Cycle through values so every severity branch is exercised
+    const std::string inputs[] = {"10.5", "80.0", "95.5"};
+    std::size_t sink = 0;
+
+    auto start = Clock::now();
+    for (std::uint64_t i = 0; i < ITERATIONS; ++i)
+    {
+        if (auto msg = formatter.formatDataToLogMsg(inputs[i % 3]))
+        {
+            sink += msg->getPayload().size();
+        }
+    }
+    auto elapsed = Clock::now() - start;
+
+    std::string name = "LogFormatter/" + std::string(magic_enum::enum_name(Policy::context));
+    return {name, 1, ITERATIONS, elapsed, {{"payload_bytes", static_cast<double>(sink) / ITERATIONS}}};
+}
+} // namespace
+
+void runFormatterBenchmarks(BenchReport &report)
+{
+    if (!report.enabled("LogFormatter/"))
+    {
+        return;
+    }
+    report.add(formatCost<CpuPolicy>());
+    report.add(formatCost<GpuPolicy>());
+    report.add(formatCost<RamPolicy>());
+    report.add(formatCost<LoadPolicy>());
+}
+} // namespace bench
@@ -0,0 +1,130 @@
+// Per-call latency of LogManager::log() across millions of calls: the tail, not the mean.
+//
+// Every producer times each log() call on its own and keeps the samples in a buffer
+// filled before the run, then the cases report p50 up to p99.99 and the maximum.
+// A short busy gap between calls keeps the rate steady, as in a control loop. The
+// same pre-built message goes through the default (flush-driven) manager, a sharded
+// one and the real-time profile, whose producers only copy into a locked slot.
+//
+//   bench_log_jitter [--calls N] [--threads N] [--gap-ns N] [--slots N] [--out file.json]
+
+#include "BenchHarness.hpp"
+#include "LogManager.hpp"
+
+#include <cstdlib>
+#include <cstring>
+
+namespace
+{
+using bench::Clock;
+
+enum class Profile
+{
+    DEFAULT,
+    SHARDED,
+    REALTIME,
+};
+
+constexpr std::size_t BUFFER_CAPACITY = 4096;
+constexpr std::size_t WORKERS = 2;
+
+std::size_t argOr(int argc, char **argv, const char *flag, std::size_t fallback)
+{
+    for (int i = 1; i + 1 < argc; ++i)
+    {
+        if (std::strcmp(argv[i], flag) == 0)
+        {
+            return static_cast<std::size_t>(std::strtoull(argv[i + 1], nullptr, 10));
+        }
+    }
+    return fallback;
+}
+
+std::unique_ptr<LogManager> makeManager(Profile profile, std::size_t slots)
+{
+    switch (profile)
+    {
+    case Profile::DEFAULT:
+        return std::make_unique<LogManager>(BUFFER_CAPACITY, WORKERS);
+    case Profile::SHARDED:
+        return std::make_unique<LogManager>(BUFFER_CAPACITY, WORKERS, 16, 1);
+    case Profile::REALTIME:
+        return std::make_unique<LogManager>(BUFFER_CAPACITY, WORKERS, 16, 1, OverflowPolicy::REJECT, 0, slots);
+    }
+    return nullptr;
+}
+
+bench::BenchResult runCase(const char *name, Profile profile, std::size_t calls, std::size_t threads,
+                           std::chrono::nanoseconds gap, std::size_t slots)
+{
+    auto manager = makeManager(profile, slots);
+    if (profile == Profile::REALTIME && !manager->isRealtime())
+    {
+        std::cerr << name << ": real-time ring could not be locked (RLIMIT_MEMLOCK?), skipped\n";
+        return {name, threads, 0, std::chrono::nanoseconds(0), {}};
+    }
+    manager->addSink(std::make_shared<bench::NullSink>());
+
+    // Longer than the small-string buffer, so copying it allocates on the buffered paths
+    const LogMessage msg(TelemetrySrc::CPU, SeverityLvl::INFO, "2024-01-01 00:00:00",
+                         "control loop tick: setpoint 42.0, measured 41.7, output 0.31");
+    const std::size_t perThread = calls / threads;
+    std::vector<std::vector<std::int64_t>> samples(threads, std::vector<std::int64_t>(perThread));
+
+    auto start = Clock::now();
+    std::vector<std::thread> producers;
+    for (std::size_t t = 0; t < threads; ++t)
+    {
+        producers.emplace_back([&, t]() {
+            auto &mine = samples[t];
+            for (std::size_t i = 0; i < perThread; ++i)
+            {
+                const auto before = Clock::now();
+                manager->log(msg);
+                const auto after = Clock::now();
+                mine[i] = (after - before).count();
+                while (Clock::now() - after < gap)
+                {
+                }
+            }
+        });
+    }
+    for (auto &producer : producers)
+    {
+        producer.join();
+    }
+    auto elapsed = Clock::now() - start;
+    manager->flushAndWait(Clock::now() + std::chrono::seconds(30));
+    const auto stats = manager->stats();
+
+    std::vector<std::int64_t> all;
+    all.reserve(perThread * threads);
+    for (const auto &mine : samples)
+    {
+        all.insert(all.end(), mine.begin(), mine.end());
+    }
+    const auto count = all.size();
+    return {name, threads, count, elapsed,
+            {{"p50_ns", bench::percentile(all, 0.50)},
+             {"p99_ns", bench::percentile(all, 0.99)},
+             {"p999_ns", bench::percentile(all, 0.999)},
+             {"p9999_ns", bench::percentile(all, 0.9999)},
+             {"max_ns", all.empty() ? 0.0 : static_cast<double>(all.back())},
+             {"dropped", static_cast<double>(stats.dropped)}}};
+}
+} // namespace
+
+int main(int argc, char **argv)
+{
+    bench::BenchReport report(argc, argv);
+    const auto calls = argOr(argc, argv, "--calls", 2000000);
+    const auto threads = std::max<std::size_t>(argOr(argc, argv, "--threads", 1), 1);
+    const auto gap = std::chrono::nanoseconds(argOr(argc, argv, "--gap-ns", 500));
+    const auto slots = argOr(argc, argv, "--slots", 1 << 16);
+
+    report.add(runCase("Jitter/default", Profile::DEFAULT, calls, threads, gap, slots));
+    report.add(runCase("Jitter/sharded", Profile::SHARDED, calls, threads, gap, slots));
+    report.add(runCase("Jitter/realtime", Profile::REALTIME, calls, threads, gap, slots));
+    report.write();
+    return 0;
+}
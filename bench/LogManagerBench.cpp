@@ -0,0 +1,112 @@
+#include "BenchHarness.hpp"
+#include "LogManager.hpp"
+#include "sinks/FileSinkImpl.hpp"
+
+#include <cstdio>
+#include <latch>
+#include <magic_enum.hpp>
+
+namespace bench
+{
+namespace
+{
+// log() from N producers until every message is written (flushAndWait).
+// Each producer logs as a different source, so sharded runs spread across shards.
+BenchResult endToEnd(const char *name, std::shared_ptr<ILogSink> sink,
+                     std::size_t producers, std::uint64_t perProducer, std::size_t shards = 0)
+{
+    LogManager manager(1024, 4, 16, shards);
+    manager.addSink(std::move(sink));
+
+    constexpr auto sources = magic_enum::enum_values<TelemetrySrc>();
+    std::latch ready(static_cast<std::ptrdiff_t>(producers + 1));
+    std::vector<std::thread> threads;
+    for (std::size_t p = 0; p < producers; ++p)
+    {
+        threads.emplace_back([&, p]() {
+            const LogMessage msg(sources[p % sources.size()], SeverityLvl::INFO, "2024-01-01 00:00:00",
+                                 "CPU: 42.0 % | Status: Normal (threshold: 75.0%)", 42.0f);
+            ready.arrive_and_wait();
+            for (std::uint64_t i = 0; i < perProducer; ++i)
+            {
+                manager.log(msg);
+            }
+        });
+    }
+
+    ready.arrive_and_wait();
+    auto start = Clock::now();
+    for (auto &thread : threads)
+    {
+        thread.join();
+    }
+    (void)manager.flushAndWait(Clock::now() + std::chrono::minutes(1));
+    auto elapsed = Clock::now() - start;
+
+    const auto stats = manager.stats();
+    return {name, producers, stats.logged - stats.dropped, elapsed,
+            {{"dropped", static_cast<double>(stats.dropped)}}};
+}
+// One producer that builds a fresh message per call, as a formatter would, then hands
+// it over by copy (log(const&)) or by move (log(&&)); no flush until the end
+BenchResult freshMessages(const char *name, bool move, std::uint64_t count)
+{
+    LogManager manager(1024, 4, 16, 0, OverflowPolicy::OVERWRITE_OLDEST);
+    manager.addSink(std::make_shared<NullSink>());
+    const std::string timeStamp = "2024-01-01 00:00:00";
+    const std::string payload = "CPU: 42.0 % | Status: Normal (threshold: 75.0%)";
+
+    auto start = Clock::now();
+    for (std::uint64_t i = 0; i < count; ++i)
+    {
+        LogMessage msg(TelemetrySrc::CPU, SeverityLvl::INFO, timeStamp, payload, 42.0f);
+        if (move)
+        {
+            manager.log(std::move(msg));
+        }
+        else
+        {
+            manager.log(msg);
+        }
+    }
+    auto elapsed = Clock::now() - start;
+    (void)manager.flushAndWait(Clock::now() + std::chrono::minutes(1));
+    return {name, 1, count, elapsed, {}};
+}
+} // namespace
+
+void runLogManagerBenchmarks(BenchReport &report)
+{
+    if (report.enabled("LogManager/nullSink"))
+    {
+        for (std::size_t producers : {1, 4})
+        {
+            report.add(endToEnd("LogManager/nullSink", std::make_shared<NullSink>(), producers, 200000));
+        }
+    }
+    if (report.enabled("LogManager/sharded"))
+    {
+        for (std::size_t producers : {1, 4})
+        {
+            report.add(endToEnd("LogManager/sharded", std::make_shared<NullSink>(), producers, 200000, producers));
+        }
+    }
+    if (report.enabled("LogManager/logCopy"))
+    {
+        report.add(freshMessages("LogManager/logCopy", false, 1000000));
+    }
+    if (report.enabled("LogManager/logMove"))
+    {
+        report.add(freshMessages("LogManager/logMove", true, 1000000));
+    }
+    if (report.enabled("LogManager/fileSink"))
+    {
+        const char *path = "logging_bench_sink.log";
+        for (std::size_t producers : {1, 4})
+        {
+            report.add(endToEnd("LogManager/fileSink", std::make_shared<FileSinkImpl>(path), producers, 50000));
+            std::remove(path);
+        }
+    }
+}
+} // namespace bench
@@ -0,0 +1,208 @@
+#include "BenchHarness.hpp"
+#include "concurrency/RingBuffer.hpp"
+
+#include <atomic>
+#include <iterator>
+#include <latch>
+#include <magic_enum.hpp>
+
+namespace bench
+{
+namespace
+{
+constexpr std::size_t CAPACITY = 1024;
+constexpr std::uint64_t ITEMS = 1 << 20;
+constexpr std::size_t BATCH = 64;
+
+// Single thread: push then pop, measures the uncontended lock/unlock cost
+BenchResult singleThread()
+{
+    RingBuffer<std::uint64_t> buffer(CAPACITY);
+    auto start = Clock::now();
+    for (std::uint64_t i = 0; i < ITEMS; ++i)
+    {
+        (void)buffer.tryPush(i);
+        (void)buffer.tryPop();
+    }
+    return {"RingBuffer/tryPushPop", 1, ITEMS, Clock::now() - start, {}};
+}
+
+// Half the threads produce, half consume; counts items moved through the buffer
+BenchResult producersConsumers(std::size_t threads)
+{
+    RingBuffer<std::uint64_t> buffer(CAPACITY);
+    const std::size_t producers = threads / 2;
+    const std::size_t consumers = threads - producers;
+    const std::uint64_t perProducer = ITEMS / producers;
+    const std::uint64_t total = perProducer * producers;
+
+    std::atomic<std::uint64_t> consumed{0};
+    std::latch ready(static_cast<std::ptrdiff_t>(threads + 1));
+    std::vector<std::thread> workers;
+
+    for (std::size_t p = 0; p < producers; ++p)
+    {
+        workers.emplace_back([&]() {
+            ready.arrive_and_wait();
+            for (std::uint64_t i = 0; i < perProducer;)
+            {
+                if (buffer.tryPush(i))
+                {
+                    ++i;
+                }
+                else
+                {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+    for (std::size_t c = 0; c < consumers; ++c)
+    {
+        workers.emplace_back([&]() {
+            ready.arrive_and_wait();
+            while (consumed.load(std::memory_order_relaxed) < total)
+            {
+                if (buffer.tryPop())
+                {
+                    consumed.fetch_add(1, std::memory_order_relaxed);
+                }
+                else
+                {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    ready.arrive_and_wait();
+    auto start = Clock::now();
+    for (auto &worker : workers)
+    {
+        worker.join();
+    }
+    return {"RingBuffer/producersConsumers", threads, total, Clock::now() - start, {}};
+}
+// Same traffic as producersConsumers, moved BATCH elements per lock with tryPushN/tryPopN
+BenchResult producersConsumersBulk(std::size_t threads)
+{
+    RingBuffer<std::uint64_t> buffer(CAPACITY);
+    const std::size_t producers = threads / 2;
+    const std::size_t consumers = threads - producers;
+    const std::uint64_t perProducer = ITEMS / producers;
+    const std::uint64_t total = perProducer * producers;
+
+    std::atomic<std::uint64_t> consumed{0};
+    std::latch ready(static_cast<std::ptrdiff_t>(threads + 1));
+    std::vector<std::thread> workers;
+
+    for (std::size_t p = 0; p < producers; ++p)
+    {
+        workers.emplace_back([&]() {
+            std::vector<std::uint64_t> batch(BATCH);
+            ready.arrive_and_wait();
+            for (std::uint64_t i = 0; i < perProducer;)
+            {
+                const auto count = static_cast<std::size_t>(std::min<std::uint64_t>(BATCH, perProducer - i));
+                const std::size_t pushed = buffer.tryPushN(std::span(batch).first(count));
+                i += pushed;
+                if (pushed == 0)
+                {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+    for (std::size_t c = 0; c < consumers; ++c)
+    {
+        workers.emplace_back([&]() {
+            std::vector<std::uint64_t> batch(BATCH);
+            ready.arrive_and_wait();
+            while (consumed.load(std::memory_order_relaxed) < total)
+            {
+                if (std::size_t popped = buffer.tryPopN(batch.begin(), BATCH))
+                {
+                    consumed.fetch_add(popped, std::memory_order_relaxed);
+                }
+                else
+                {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    ready.arrive_and_wait();
+    auto start = Clock::now();
+    for (auto &worker : workers)
+    {
+        worker.join();
+    }
+    return {"RingBuffer/producersConsumersBulk", threads, total, Clock::now() - start, {}};
+}
+
+// Bursty push-to-pop latency into a consumer blocked in pop(), and the CPU used meanwhile
+BenchResult handoff(WaitStrategy strategy)
+{
+    RingBuffer<std::int64_t> buffer(CAPACITY, OverflowPolicy::REJECT, strategy);
+    std::vector<std::int64_t> latency;
+    latency.reserve(HANDOFF_ITEMS);
+
+    const auto cpuStart = processCpuTime();
+    const auto start = Clock::now();
+    std::thread consumer([&]() {
+        for (std::size_t i = 0; i < HANDOFF_ITEMS; ++i)
+        {
+            const std::int64_t sent = buffer.pop();
+            latency.push_back(nowNs() - sent);
+        }
+    });
+    for (std::size_t i = 0; i < HANDOFF_ITEMS; ++i)
+    {
+        buffer.push(nowNs());
+        if ((i + 1) % HANDOFF_BURST == 0)
+        {
+            std::this_thread::sleep_for(HANDOFF_GAP);
+        }
+    }
+    consumer.join();
+    const auto elapsed = Clock::now() - start;
+    const auto cpu = processCpuTime() - cpuStart;
+
+    return {"RingBuffer/handoff/" + std::string(magic_enum::enum_name(strategy)), 2, HANDOFF_ITEMS, elapsed,
+            {{"p50_ns", percentile(latency, 0.50)},
+             {"p99_ns", percentile(latency, 0.99)},
+             {"max_ns", static_cast<double>(latency.back())},
+             {"cpu_ms", std::chrono::duration<double, std::milli>(cpu).count()}}};
+}
+} // namespace
+
+void runRingBufferBenchmarks(BenchReport &report)
+{
+    if (report.enabled("RingBuffer/tryPushPop"))
+    {
+        report.add(singleThread());
+    }
+    if (report.enabled("RingBuffer/producersConsumers"))
+    {
+        for (std::size_t threads : {2, 4, 8, 16, 32})
+        {
+            report.add(producersConsumers(threads));
+        }
+    }
+    if (report.enabled("RingBuffer/producersConsumersBulk"))
+    {
+        for (std::size_t threads : {2, 4, 8, 16, 32})
+        {
+            report.add(producersConsumersBulk(threads));
+        }
+    }
+    if (report.enabled("RingBuffer/handoff"))
+    {
+        for (auto strategy : {WaitStrategy::BLOCK, WaitStrategy::ADAPTIVE, WaitStrategy::SPIN})
+        {
+            report.add(handoff(strategy));
+        }
+    }
+}
+} // namespace bench
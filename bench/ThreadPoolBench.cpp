@@ -0,0 +1,120 @@
+#include "BenchHarness.hpp"
+#include "concurrency/ThreadPool.hpp"
+
+#include <atomic>
+#include <latch>
+#include <magic_enum.hpp>
+
+namespace bench
+{
+namespace
+{
+constexpr std::size_t WORKERS = 4;
+constexpr std::uint64_t TASKS_PER_PRODUCER = 100000;
+
+// Latency of a single enqueue() call (lock, std::function move, notify) under
+// contention from other producers and the workers draining the queue
+BenchResult enqueueLatency(std::size_t producers)
+{
+    std::atomic<std::uint64_t> executed{0};
+    std::vector<std::vector<std::int64_t>> samples(producers);
+    std::latch ready(static_cast<std::ptrdiff_t>(producers + 1));
+    std::chrono::nanoseconds elapsed{0};
+
+    {
+        ThreadPool pool(WORKERS);
+        std::vector<std::thread> threads;
+        for (std::size_t p = 0; p < producers; ++p)
+        {
+            threads.emplace_back([&, p]() {
+                auto &mine = samples[p];
+                mine.reserve(TASKS_PER_PRODUCER);
+                ready.arrive_and_wait();
+                for (std::uint64_t i = 0; i < TASKS_PER_PRODUCER; ++i)
+                {
+                    auto begin = Clock::now();
+                    pool.enqueue([&executed]() { executed.fetch_add(1, std::memory_order_relaxed); });
+                    mine.push_back((Clock::now() - begin).count());
+                }
+            });
+        }
+
+        ready.arrive_and_wait();
+        auto start = Clock::now();
+        for (auto &thread : threads)
+        {
+            thread.join();
+        }
+        elapsed = Clock::now() - start;
+    } // pool destructor drains the remaining tasks
+
+    std::vector<std::int64_t> all;
+    for (auto &mine : samples)
+    {
+        all.insert(all.end(), mine.begin(), mine.end());
+    }
+    return {"ThreadPool/enqueue", producers, TASKS_PER_PRODUCER * producers, elapsed,
+            {{"p50_ns", percentile(all, 0.50)},
+             {"p99_ns", percentile(all, 0.99)},
+             {"p999_ns", percentile(all, 0.999)},
+             {"max_ns", static_cast<double>(all.back())}}};
+}
+
+// Bursty enqueue-to-start latency with one worker, and the CPU the pool burns meanwhile
+BenchResult handoff(WaitStrategy strategy)
+{
+    std::vector<std::int64_t> latency(HANDOFF_ITEMS);
+    std::atomic<std::size_t> done{0};
+    std::chrono::nanoseconds elapsed{0};
+    std::chrono::nanoseconds cpu{0};
+
+    {
+        ThreadPool pool(1, strategy);
+        const auto cpuStart = processCpuTime();
+        const auto start = Clock::now();
+        for (std::size_t i = 0; i < HANDOFF_ITEMS; ++i)
+        {
+            const std::int64_t sent = nowNs();
+            pool.enqueue([&latency, &done, i, sent]() {
+                latency[i] = nowNs() - sent;
+                done.fetch_add(1, std::memory_order_release);
+            });
+            if ((i + 1) % HANDOFF_BURST == 0)
+            {
+                std::this_thread::sleep_for(HANDOFF_GAP);
+            }
+        }
+        while (done.load(std::memory_order_acquire) < HANDOFF_ITEMS)
+        {
+            std::this_thread::yield();
+        }
+        elapsed = Clock::now() - start;
+        cpu = processCpuTime() - cpuStart;
+    }
+
+    return {"ThreadPool/handoff/" + std::string(magic_enum::enum_name(strategy)), 1, HANDOFF_ITEMS, elapsed,
+            {{"p50_ns", percentile(latency, 0.50)},
+             {"p99_ns", percentile(latency, 0.99)},
+             {"max_ns", static_cast<double>(latency.back())},
+             {"cpu_ms", std::chrono::duration<double, std::milli>(cpu).count()}}};
+}
+} // namespace
+
+void runThreadPoolBenchmarks(BenchReport &report)
+{
+    if (report.enabled("ThreadPool/enqueue"))
+    {
+        for (std::size_t producers : {1, 2, 4, 8})
+        {
+            report.add(enqueueLatency(producers));
+        }
+    }
+    if (report.enabled("ThreadPool/handoff"))
+    {
+        for (auto strategy : {WaitStrategy::BLOCK, WaitStrategy::ADAPTIVE, WaitStrategy::SPIN})
+        {
+            report.add(handoff(strategy));
+        }
+    }
+}
+} // namespace bench
@@ -4,6 +4,7 @@
 #include <optional>
 #include "LogMessage.hpp"
 #include "LogPolicies.hpp"
+#include "utils/Trace.hpp"
 #include <string>
 #include <chrono>
 #include <sstream>
@@ -25,6 +26,7 @@ private:
 template <typename Policy>
 std::optional<LogMessage> LogFormatter<Policy>::formatDataToLogMsg(const std::string &raw)
 {
+    LOG_TRACE_SPAN("format");
     if (raw.empty())
     {
         return std::nullopt;
@@ -37,7 +39,8 @@ std::optional<LogMessage> LogFormatter<Policy>::formatDataToLogMsg(const std::st
         Policy::context,
         severity,
         currentTimeStamp(),
-        msgDescription(val, severity));
+        msgDescription(val, severity),
+        val);
 }
 
 template <typename Policy>
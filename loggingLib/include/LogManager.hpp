@@ -3,30 +3,247 @@
 #include "interfaces/ILogSink.hpp"
 #include <memory>
 #include <vector>
+#include <atomic>
+#include <mutex>
+#include <queue>
+#include <future>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <array>
+#include <utility>
+#include <thread>
+#include <string_view>
+#include <magic_enum.hpp>
 #include "concurrency/RingBuffer.hpp"
 #include "LogMessage.hpp"
 #include "concurrency/ThreadPool.hpp"
+#include "concurrency/ThreadLocalCounters.hpp"
+#include "concurrency/RealtimeRing.hpp"
+#include "utils/ThreadTuning.hpp"
+#include "core/DispatchJournal.hpp"
+#include "core/CrashHandler.hpp"
+
+// Backpressure signal, see LogManager::pressure()
+struct LogPressure
+{
+    float fill = 0.0f;   // 0..1: main buffer or pool backlog, whichever is fuller
+    float trend = 0.0f;  // smoothed change of 'fill' per second, > 0 while filling up
+    PressureLevel level = PressureLevel::NORMAL;
+};
+using PressureCallback = std::function<void(const LogPressure &)>;
+
+// Point-in-time view of LogManager internals, see LogManager::stats()
+struct LogManagerStats
+{
+    std::size_t bufferDepth = 0;
+    std::size_t bufferCapacity = 0;
+    std::size_t criticalDepth = 0;
+    std::size_t poolBacklog = 0;
+    std::size_t workerCount = 0;
+    std::chrono::nanoseconds poolQueueWait{0};  // smoothed time a write waits for a worker
+    std::uint64_t logged = 0;
+    std::uint64_t dropped = 0;
+    std::uint64_t overwritten = 0;  // discarded by OverflowPolicy::OVERWRITE_OLDEST
+    std::size_t bufferedBytes = 0;  // buffered or queued on the pool; tracked only with a byte budget
+    std::size_t byteBudget = 0;     // 0: unlimited
+    std::size_t realtimeDepth = 0;     // records in the real-time ring, not yet forwarded
+    std::size_t realtimeCapacity = 0;  // 0: real-time profile off
+    std::array<std::uint64_t, magic_enum::enum_count<SeverityLvl>()> severityCounts{};  // indexed by SeverityLvl
+    std::chrono::nanoseconds lastFlushDuration{0};
+    std::vector<std::chrono::nanoseconds> sinkWriteLatency;  // smoothed, one per attached sink
+    std::vector<std::pair<TelemetrySrc, float>> latestValues;  // last sample per source seen so far
+    LogPressure pressure;
+};
 
 class LogManager
 {
 private:
     static constexpr std::size_t DEFAULT_BUFFER_CAPACITY = 100;
     static constexpr std::size_t DEFAULT_THREAD_COUNT = 4;
+    static constexpr std::size_t DEFAULT_CRITICAL_CAPACITY = 16;
 
-    std::vector<std::shared_ptr<ILogSink>> sinks;
-    RingBuffer<LogMessage> buffer;
+    // Shared by every sink a flushAsync() call waits on; fulfilled by the last one to arrive
+    struct FlushBarrier
+    {
+        std::atomic<std::size_t> remaining;
+        std::promise<void> done;
+
+        explicit FlushBarrier(std::size_t parties) : remaining(parties) {}
+        void arrive();
+    };
+
+    // One registered sink plus the bookkeeping needed to detach it safely.
+    // 'pending' counts writes queued on the pool that have not finished yet.
+    // Every dispatched write gets a per-sink sequence number; 'watermark' is the
+    // highest sequence for which that write and all earlier ones have completed.
+    struct SinkSlot
+    {
+        std::shared_ptr<ILogSink> sink;
+        std::atomic<std::size_t> pending{0};
+        std::atomic<bool> retired{false};
+        std::atomic<std::uint64_t> dispatched{0};
+        std::atomic<std::int64_t> writeLatencyNanos{0};  // moving average
+
+        std::mutex progressMutex;
+        std::uint64_t watermark = 0;
+        std::priority_queue<std::uint64_t, std::vector<std::uint64_t>, std::greater<>> finishedAhead;
+        std::vector<std::pair<std::uint64_t, std::shared_ptr<FlushBarrier>>> waiters;
+
+        explicit SinkSlot(std::shared_ptr<ILogSink> s) : sink(std::move(s)) {}
+
+        bool acquire() noexcept;
+        void release() noexcept;
+        void drain() const noexcept;
+
+        [[nodiscard]] std::uint64_t nextSequence() noexcept;
+        void complete(std::uint64_t sequence);
+        void notifyWhenWritten(std::uint64_t sequence, std::shared_ptr<FlushBarrier> barrier);
+        void recordWriteLatency(std::chrono::nanoseconds latency) noexcept;
+    };
+    using SinkList = std::vector<std::shared_ptr<SinkSlot>>;
+
+    // Copy-on-write: route() reads a snapshot without locking,
+    // addSink()/removeSink() publish a new list under sinkUpdateMutex.
+    std::atomic<std::shared_ptr<const SinkList>> sinks{std::make_shared<const SinkList>()};
+    std::mutex sinkUpdateMutex;
+    // Messages moved out of a buffer per lock acquisition. Popped but not yet dispatched
+    // messages of the current batch are not included in a crash dump.
+    static constexpr std::size_t DRAIN_BATCH = 256;
+
+    // One buffer plus the lock held while moving its messages out, so a flush barrier
+    // never misses a message another thread has popped but not yet dispatched.
+    // Without a consumer thread, flush() drains it onto the pool. With one (sharded
+    // mode), the consumer drains it continuously and writes to the sinks itself, in
+    // pop order; 'drained' counts what it has written so flushAsync() can wait for it.
+    struct Shard
+    {
+        RingBuffer<LogMessage> buffer;
+        std::mutex drainMutex;
+        std::uint64_t drained = 0;  // guarded by drainMutex
+        std::vector<std::pair<std::uint64_t, std::shared_ptr<FlushBarrier>>> waiters;  // guarded by drainMutex
+        std::vector<LogMessage> batch;  // reused by drains, guarded by drainMutex
+        std::thread consumer;
+
+        Shard(std::size_t capacity, OverflowPolicy overflow) : buffer(capacity, overflow) { batch.reserve(DRAIN_BATCH); }
+    };
+    static constexpr std::chrono::milliseconds CONSUMER_WAIT{100};
+
+    std::mutex criticalDrainMutex;
+    // Sharded mode hashes messages by TelemetrySrc, so each source keeps its order and
+    // sources on different shards never contend. Otherwise there is a single shard.
+    std::vector<std::unique_ptr<Shard>> shards;
+    std::atomic<bool> stopping{false};
+    // Real-time profile: producers only copy into this preallocated, mlock'ed ring; the
+    // forwarder thread moves records on into the shards. It polls, since producers
+    // never wake anyone, so the ring must absorb REALTIME_POLL worth of messages.
+    static constexpr std::chrono::microseconds REALTIME_POLL{500};
+    std::unique_ptr<RealtimeRing> realtimeRing;
+    std::mutex realtimeDrainMutex;  // one forwarder at a time: the ring has a single consumer
+    std::thread realtimeForwarder;
+    std::atomic<bool> realtimeStopping{false};
+    // Applied by each logging thread to itself; consumers poll the generation between drains
+    mutable std::mutex tuningMutex;
+    ThreadTuning threadTuning;
+    std::atomic<std::uint64_t> tuningGeneration{0};
+    // Byte budget over the main buffers plus their messages queued on the pool. When set,
+    // the rings reject when full and the overflow policy is applied here, so every
+    // discarded message is released from the budget. The CRITICAL lane is not charged.
+    const std::size_t byteBudget;
+    const OverflowPolicy overflowPolicy;
+    std::atomic<std::size_t> bufferedBytes{0};
+    RingBuffer<LogMessage> criticalBuffer;  // priority lane, dispatched as soon as logged
+    // Messages handed to the pool, kept for the crash handler (guarded by the drain mutexes).
+    // Consumer threads write directly and are not journaled.
+    DispatchJournal dispatchJournal;
+    DispatchJournal criticalJournal;
+    std::unique_ptr<CrashHandler> crashHandler;
     std::unique_ptr<ThreadPool> threadPool;
 
-    void route(const LogMessage &msg);
+    // Health counters, see stats(). Per-thread so that producers never share
+    // a cache line and readers (stats(), MetricsServer) never block them.
+    enum Counter : std::size_t
+    {
+        LOGGED,
+        DROPPED,
+        OVERWRITTEN,  // discarded for the byte budget; ring overwrites are counted by the ring
+        SEVERITY_BASE  // one counter per SeverityLvl from here on
+    };
+    static constexpr std::size_t COUNTER_COUNT = SEVERITY_BASE + magic_enum::enum_count<SeverityLvl>();
+    ThreadLocalCounters<COUNTER_COUNT> counters;
+    std::atomic<std::int64_t> lastFlushNanos{0};
+
+    struct LatestValue
+    {
+        std::atomic<float> value{0.0f};
+        std::atomic<bool> seen{false};
+    };
+    std::array<LatestValue, magic_enum::enum_count<TelemetrySrc>()> latestValues;
+
+    // Backpressure, re-evaluated at the start of every flush, and by the shard consumers
+    // and the real-time forwarder at most every PRESSURE_INTERVAL, since those modes may
+    // never be flushed. The level uses the fill
+    // projected one second ahead by the trend, and steps down only once the fill is
+    // PRESSURE_HYSTERESIS below the threshold it crossed, so it does not flap.
+    static constexpr float PRESSURE_ELEVATED = 0.5f;
+    static constexpr float PRESSURE_HIGH = 0.8f;
+    static constexpr float PRESSURE_HYSTERESIS = 0.1f;
+    static constexpr float PRESSURE_TREND_ALPHA = 0.3f;
+    static constexpr std::chrono::milliseconds PRESSURE_INTERVAL{10};
+    std::atomic<std::int64_t> nextPressureUpdate{0};  // steady_clock ticks
+    std::atomic<float> pressureFill{0.0f};
+    std::atomic<float> pressureTrend{0.0f};
+    std::atomic<PressureLevel> pressureLevel{PressureLevel::NORMAL};
+    std::mutex pressureMutex;  // serializes updates, guards the members below
+    std::chrono::steady_clock::time_point lastPressureUpdate{};
+    std::vector<std::pair<std::size_t, PressureCallback>> pressureSubscribers;
+    std::size_t nextPressureSubscriber = 1;
+
+    void route(const LogMessage &msg, bool priority = false);
+    void dispatch(LogMessage &&msg);
+    bool forwardRealtime();
+    void forwardLoop();
+    void writeInline(const LogMessage &msg);
+    void drainToPool(Shard &shard);
+    void drainShard(Shard &shard);
+    [[nodiscard]] std::vector<std::shared_ptr<FlushBarrier>> takeReachedWaiters(Shard &shard);
+    void consume(Shard &shard, std::size_t index);
+    void applyTuning(std::uint64_t &applied);
+    void initWorker();
+    [[nodiscard]] Shard &shardFor(TelemetrySrc source) noexcept;
+    [[nodiscard]] std::vector<std::unique_lock<std::mutex>> lockShards();
+    void countLogged(TelemetrySrc source, SeverityLvl severity, std::optional<float> value) noexcept;
+    template <typename... Args>
+    void enqueue(Shard &shard, std::size_t bytes, Args &&...args);
+    bool chargeBytes(Shard &shard, std::size_t bytes);
+    bool discardOldest(Shard &shard);
+    void releaseBytes(std::size_t bytes) noexcept;
+    void finishEntry(InFlightMessage &entry) noexcept;
+    void logCritical(LogMessage &&msg);
+    void flushCritical();
+    void emergencyDump(int fd) const noexcept;
+    void updatePressure();
+    void updatePressureIfDue();
 
 public:
+    // 'shardCount' 0: one buffer, drained by flush() onto the pool.
+    // 'shardCount' N: N buffers of 'bufferCapacity' each, every one with its own consumer
+    // thread; flush() is then only needed for the CRITICAL lane and barriers.
+    // 'overflow' applies to the main buffers; OVERWRITE_OLDEST keeps the newest messages
+    // and never makes log() flush inline. The CRITICAL lane always rejects when full.
+    // 'byteBudget' (0: none) caps the bytes held by buffered and pool-queued messages;
+    // 'overflow' then also decides what happens when the cap is reached.
+    // 'realtimeSlots' (0: off, else a power of two) turns on the real-time profile: see
+    // isRealtime(). It implies sharded mode, so at least one shard is created.
     explicit LogManager(
         std::size_t bufferCapacity = DEFAULT_BUFFER_CAPACITY, 
-        std::size_t numThreads = DEFAULT_THREAD_COUNT)
-        : buffer(bufferCapacity),
-          threadPool(std::make_unique<ThreadPool>(numThreads))
-    {
-    }
+        std::size_t numThreads = DEFAULT_THREAD_COUNT,
+        std::size_t criticalCapacity = DEFAULT_CRITICAL_CAPACITY,
+        std::size_t shardCount = 0,
+        OverflowPolicy overflow = OverflowPolicy::REJECT,
+        std::size_t byteBudget = 0,
+        std::size_t realtimeSlots = 0);
+    ~LogManager();
 
     // Non-copyable, non-movable
     LogManager(const LogManager &other) = delete;
@@ -34,7 +251,74 @@ public:
     LogManager &operator=(const LogManager &other) = delete;
     LogManager &operator=(LogManager &&other) = delete;
 
+    // Safe to call while other threads are logging/flushing.
     void addSink(std::shared_ptr<ILogSink> sink);
+    // Detaches the sink and blocks until its queued writes have finished.
+    // Returns false if the sink was not registered.
+    bool removeSink(const std::shared_ptr<ILogSink> &sink);
+    [[nodiscard]] std::size_t sinkCount() const;
+
+    // CRITICAL messages skip the main buffer and go straight to the pool's priority lane
     void log(const LogMessage &msg);
+    // Moves the message into the buffer slot instead of copying it
+    void log(LogMessage &&msg);
+    // Constructs the message directly in the buffer slot; pass the strings as rvalues
+    void emplaceLog(TelemetrySrc source, SeverityLvl severity, std::string timeStamp, std::string payload);
+    void emplaceLog(TelemetrySrc source, SeverityLvl severity, std::string timeStamp, std::string payload,
+                    float value);
+    // Copies from views the caller keeps; with the real-time profile nothing is allocated
+    // on either side of the call
+    void logView(TelemetrySrc source, SeverityLvl severity, std::string_view timeStamp, std::string_view payload,
+                 std::optional<float> value = std::nullopt);
+
+    // With the real-time profile every log call above only copies the message into a
+    // slot of a preallocated, mlock'ed ring: bounded time, no allocation, lock or
+    // syscall. Longer fields are truncated to the slot (RealtimeRing::PAYLOAD_BYTES);
+    // a full ring drops. A forwarder thread feeds the ring into the normal pipeline,
+    // and flush()/flushAsync() forward what was logged before them first.
+    // False if the ring could not be allocated or locked.
+    [[nodiscard]] bool isRealtime() const noexcept { return realtimeRing != nullptr; }
+    // Hands buffered messages to the pool; returns before they are written
     void flush();
-};
\ No newline at end of file
+    // Like flush(), but the future becomes ready once every sink has written
+    // all messages logged before the call
+    [[nodiscard]] std::future<void> flushAsync();
+    // Blocks until flushAsync() completes; returns false if the deadline passed first
+    bool flushAndWait(std::chrono::steady_clock::time_point deadline);
+
+    // Runtime sizing; producers keep logging while these run.
+    // resizeBuffer() sets every shard's capacity. Messages that no longer fit are
+    // moved on first, as by flush(), so none are lost. False for 0.
+    bool resizeBuffer(std::size_t capacity);
+    // Surplus workers finish their current write and leave; queued writes stay queued
+    bool setWorkerCount(std::size_t count);
+    // Lets the pool grow and shrink between the bounds, driven by how long writes queue
+    bool setWorkerBounds(const ThreadPoolBounds &bounds);
+    // How idle pool workers and shard consumers wait for work; BLOCK by default.
+    // Spinning cuts hand-off latency on bursts at the cost of busy cores.
+    void setPoolWaitStrategy(WaitStrategy strategy);
+    void setBufferWaitStrategy(WaitStrategy strategy);
+    // CPU set, scheduling class, nice and I/O class for the pool workers and shard
+    // consumers, applied by each thread to itself (consumers within CONSUMER_WAIT).
+    // Best effort; a field left unset keeps whatever the thread already has.
+    void setThreadTuning(const ThreadTuning &tuning);
+
+    // Snapshot of queue depths, drop count, flush duration, pool backlog and
+    // per-sink write latency; sampled by LogManagerTelemetrySourceImpl
+    [[nodiscard]] LogManagerStats stats() const;
+
+    // Current backpressure; lock-free, cheap enough to poll from a sampling loop
+    [[nodiscard]] LogPressure pressure() const;
+    // 'callback' runs on the thread that re-evaluated pressure (a flushing thread, a shard
+    // consumer or the real-time forwarder) whenever the level changes; it must not call
+    // flush()/flushAsync(). Returns an id for unsubscribePressure().
+    std::size_t subscribePressure(PressureCallback callback);
+    void unsubscribePressure(std::size_t id);
+
+    // Opt-in: on SIGSEGV/SIGABRT/SIGBUS/SIGFPE/SIGILL, write every message still
+    // buffered or queued on the pool to 'dumpPath' using only write(2).
+    // 'journalSize' bounds how many pool-queued messages are tracked for that.
+    // Only one LogManager per process can have it enabled.
+    bool enableCrashHandler(const std::string &dumpPath, std::size_t journalSize = 1024);
+    void disableCrashHandler();
+};
@@ -7,12 +7,21 @@
 #include <string>
 #include <memory>
 #include <expected>
+#include <optional>
+#include <chrono>
 
 enum class BuilderError
 {
     NO_SINKS_CONFIGURED,
     INVALID_BUFFER_SIZE,
     INVALID_THREADPOOL_SIZE,
+    INVALID_CRITICAL_BUFFER_SIZE,
+    INVALID_SHARD_COUNT,
+    INVALID_BYTE_BUDGET,
+    INVALID_CPU_SET,
+    INVALID_NICE,
+    INVALID_REALTIME_SLOTS,
+    REALTIME_SETUP_FAILED,  // ring could not be mapped or mlock'ed (RLIMIT_MEMLOCK?)
     EMPTY_FILEPATH,
     NULL_SINK,
     SINK_CREATION_FAILED
@@ -24,6 +33,15 @@ private:
     std::vector<std::shared_ptr<ILogSink>> sinks;
     std::size_t bufferSize = 100;
     std::size_t threadPoolSize = 4;
+    std::size_t criticalBufferSize = 16;
+    std::size_t shardCount = 0;
+    OverflowPolicy overflowPolicy = OverflowPolicy::REJECT;
+    std::size_t byteBudget = 0;
+    std::size_t realtimeSlots = 0;
+    std::optional<ThreadPoolBounds> poolBounds;
+    WaitStrategy poolWait = WaitStrategy::BLOCK;
+    WaitStrategy bufferWait = WaitStrategy::BLOCK;
+    ThreadTuning threadTuning;
     std::vector<BuilderError> errors;
 
 public:
@@ -35,6 +53,32 @@ public:
     LogManagerBuilder &withSink(LogSinkType type, const std::string &config = "");
     LogManagerBuilder &withBufferSize(std::size_t size);
     LogManagerBuilder &withthreadPoolSize(std::size_t size);
+    // Replaces withthreadPoolSize(): starts minThreads workers, adds one while writes wait
+    // longer than waitTarget for a worker, up to maxThreads; idle extras leave after idleTimeout
+    LogManagerBuilder &withElasticThreadPool(std::size_t minThreads, std::size_t maxThreads,
+                                             std::chrono::microseconds waitTarget = std::chrono::milliseconds(1),
+                                             std::chrono::milliseconds idleTimeout = std::chrono::seconds(5));
+    LogManagerBuilder &withCriticalBufferSize(std::size_t size);
+    // How idle pool workers / shard consumers wait; see WaitStrategy
+    LogManagerBuilder &withPoolWaitStrategy(WaitStrategy strategy);
+    LogManagerBuilder &withBufferWaitStrategy(WaitStrategy strategy);
+    // Keep the pool workers and shard consumers off the application's cores and
+    // out of its way: CPU set, SCHED_IDLE, nice and the idle I/O class
+    LogManagerBuilder &withCpuAffinity(std::vector<int> cpus);
+    LogManagerBuilder &withIdleScheduling();
+    LogManagerBuilder &withNice(int nice);
+    LogManagerBuilder &withIdleIoPriority();
+    // N buffers of withBufferSize() each, hashed by source, every one drained by its own thread
+    LogManagerBuilder &withShards(std::size_t count);
+    // OVERWRITE_OLDEST: a full buffer discards its oldest message instead of the new one
+    LogManagerBuilder &withOverflowPolicy(OverflowPolicy policy);
+    // Caps the bytes held by buffered and pool-queued messages; the overflow policy
+    // applies when the cap is reached. The message-count capacity still applies too.
+    LogManagerBuilder &withByteBudget(std::size_t bytes);
+    // Low-jitter producers: log calls copy into 'slots' (a power of two) preallocated,
+    // mlock'ed fixed-size slots and return; see LogManager::isRealtime(). Implies withShards(1)
+    // unless more shards are configured.
+    LogManagerBuilder &withRealtimeProfile(std::size_t slots);
 
     [[nodiscard]] std::unique_ptr<LogManager> build();
     [[nodiscard]] std::expected<std::unique_ptr<LogManager>, BuilderError> tryBuild();
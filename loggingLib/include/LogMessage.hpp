@@ -2,6 +2,8 @@
 
 #include <string>
 #include <ostream>
+#include <optional>
+#include <chrono>
 #include "LogTypes.hpp"
 
 class LogMessage
@@ -11,6 +13,8 @@ private:
     SeverityLvl severity;
     std::string timeStamp;
     std::string payload;
+    std::optional<float> value;  // numeric sample the message was formatted from, if any
+    std::chrono::system_clock::time_point time = std::chrono::system_clock::now();  // machine-readable twin of timeStamp
 
 public:
     LogMessage() = delete;
@@ -18,6 +22,18 @@ public:
                SeverityLvl severity,
                std::string timeStamp,
                std::string payload);
+    LogMessage(TelemetrySrc source,
+               SeverityLvl severity,
+               std::string timeStamp,
+               std::string payload,
+               float value);
+    // For a message rebuilt elsewhere (e.g. from a ring slot) that keeps the time it was logged at
+    LogMessage(TelemetrySrc source,
+               SeverityLvl severity,
+               std::string timeStamp,
+               std::string payload,
+               std::optional<float> value,
+               std::chrono::system_clock::time_point time);
 
     LogMessage(const LogMessage &) = default;
     LogMessage(LogMessage &&) = default;
@@ -25,5 +41,12 @@ public:
     LogMessage &operator=(LogMessage &&) = default;
     ~LogMessage() = default;
 
+    [[nodiscard]] TelemetrySrc getSource() const noexcept { return source; }
+    [[nodiscard]] SeverityLvl getSeverity() const noexcept { return severity; }
+    [[nodiscard]] const std::string &getTimeStamp() const noexcept { return timeStamp; }
+    [[nodiscard]] const std::string &getPayload() const noexcept { return payload; }
+    [[nodiscard]] std::optional<float> getValue() const noexcept { return value; }
+    [[nodiscard]] std::chrono::system_clock::time_point getTime() const noexcept { return time; }
+
     friend std::ostream &operator<<(std::ostream &os, const LogMessage &msg);
 };
\ No newline at end of file
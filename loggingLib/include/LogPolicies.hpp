@@ -64,3 +64,76 @@ struct LoadPolicy
             :                    SeverityLvl::INFO;
     }
 };
+
+// ===== LogManager self-telemetry =====
+
+struct LogQueuePolicy
+{
+    static constexpr TelemetrySrc context = TelemetrySrc::LOG_QUEUE;
+    static constexpr std::string_view unit = "%";
+    static constexpr float WARNING = 70.0f;
+    static constexpr float CRITICAL = 90.0f;
+
+    static constexpr SeverityLvl inferSeverity(float val) noexcept {
+        return (val > CRITICAL) ? SeverityLvl::CRITICAL
+            : (val > WARNING)  ? SeverityLvl::WARNING
+            :                    SeverityLvl::INFO;
+    }
+};
+
+// Any drop is worth a warning: it means data is already being lost
+struct LogDropPolicy
+{
+    static constexpr TelemetrySrc context = TelemetrySrc::LOG_DROPS;
+    static constexpr std::string_view unit = "msgs";
+    static constexpr float WARNING = 0.0f;
+    static constexpr float CRITICAL = 100.0f;
+
+    static constexpr SeverityLvl inferSeverity(float val) noexcept {
+        return (val > CRITICAL) ? SeverityLvl::CRITICAL
+            : (val > WARNING)  ? SeverityLvl::WARNING
+            :                    SeverityLvl::INFO;
+    }
+};
+
+struct LogFlushPolicy
+{
+    static constexpr TelemetrySrc context = TelemetrySrc::LOG_FLUSH;
+    static constexpr std::string_view unit = "ms";
+    static constexpr float WARNING = 50.0f;
+    static constexpr float CRITICAL = 200.0f;
+
+    static constexpr SeverityLvl inferSeverity(float val) noexcept {
+        return (val > CRITICAL) ? SeverityLvl::CRITICAL
+            : (val > WARNING)  ? SeverityLvl::WARNING
+            :                    SeverityLvl::INFO;
+    }
+};
+
+struct LogBacklogPolicy
+{
+    static constexpr TelemetrySrc context = TelemetrySrc::LOG_BACKLOG;
+    static constexpr std::string_view unit = "tasks";
+    static constexpr float WARNING = 1000.0f;
+    static constexpr float CRITICAL = 10000.0f;
+
+    static constexpr SeverityLvl inferSeverity(float val) noexcept {
+        return (val > CRITICAL) ? SeverityLvl::CRITICAL
+            : (val > WARNING)  ? SeverityLvl::WARNING
+            :                    SeverityLvl::INFO;
+    }
+};
+
+struct LogSinkLatencyPolicy
+{
+    static constexpr TelemetrySrc context = TelemetrySrc::LOG_SINK_LATENCY;
+    static constexpr std::string_view unit = "ms";
+    static constexpr float WARNING = 10.0f;
+    static constexpr float CRITICAL = 100.0f;
+
+    static constexpr SeverityLvl inferSeverity(float val) noexcept {
+        return (val > CRITICAL) ? SeverityLvl::CRITICAL
+            : (val > WARNING)  ? SeverityLvl::WARNING
+            :                    SeverityLvl::INFO;
+    }
+};
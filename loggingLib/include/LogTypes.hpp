@@ -3,7 +3,9 @@
 enum class LogSinkType {
     CONSOLE,
     FILE,
-    SOCKET
+    SOCKET,
+    BINARY,     // block-indexed binary file, queried with logq
+    TIMESERIES  // compressed per-source samples, read with TimeSeriesReader
 };
 
 enum class SeverityLvl {
@@ -16,6 +18,26 @@ enum class TelemetrySrc {
     GPU,
     CPU,
     RAM,
-    LOAD  // SomeIP load percentage
+    LOAD,  // SomeIP load percentage
+    // LogManager self-telemetry
+    LOG_QUEUE,
+    LOG_DROPS,
+    LOG_FLUSH,
+    LOG_BACKLOG,
+    LOG_SINK_LATENCY
 };
 
+// Internal LogManager metrics exposed through LogManagerTelemetrySourceImpl
+enum class LoggerMetric {
+    QUEUE_FILL,       // % of the main buffer in use
+    DROPS,            // messages dropped or overwritten since the previous read
+    FLUSH_DURATION,   // ms spent in the last flush()
+    POOL_BACKLOG,     // tasks waiting on the ThreadPool
+    SINK_LATENCY      // ms, slowest sink's smoothed write time
+};
+
+enum class PressureLevel {
+    NORMAL,
+    ELEVATED,  // sources should sample less often
+    HIGH       // close to dropping; shed everything that is not critical
+};
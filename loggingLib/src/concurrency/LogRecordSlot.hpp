@@ -0,0 +1,68 @@
+#pragma once
+
+#include "LogMessage.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <string_view>
+
+// One log record in a fixed 256-byte slot, the layout ShmRing and RealtimeRing share.
+// The producer's LogMessage::time travels in the slot, so the message rebuilt on the
+// consumer side keeps the time it was logged at. Longer fields are truncated.
+struct alignas(64) LogRecordSlot
+{
+    static constexpr std::size_t SLOT_BYTES = 256;
+    static constexpr std::size_t TIMESTAMP_BYTES = 32;
+    static constexpr std::size_t PAYLOAD_BYTES = 198;
+    static constexpr std::uint8_t FLAG_HAS_VALUE = 0x1;
+
+    std::atomic<std::uint64_t> state;  // owned by SlotQueue
+    std::int64_t timeNs;               // LogMessage::time, system_clock nanoseconds
+    float value;
+    std::uint16_t payloadLength;
+    std::uint8_t timeStampLength;
+    std::uint8_t source;
+    std::uint8_t severity;
+    std::uint8_t flags;
+    char timeStamp[TIMESTAMP_BYTES];
+    char payload[PAYLOAD_BYTES];
+
+    void store(TelemetrySrc source, SeverityLvl severity, std::string_view timeStamp, std::string_view payload,
+               std::optional<float> value, std::chrono::system_clock::time_point time) noexcept
+    {
+        const std::size_t stampLength = std::min(timeStamp.size(), TIMESTAMP_BYTES);
+        const std::size_t length = std::min(payload.size(), PAYLOAD_BYTES);
+        this->timeNs = std::chrono::duration_cast<std::chrono::nanoseconds>(time.time_since_epoch()).count();
+        this->value = value.value_or(0.0f);
+        this->payloadLength = static_cast<std::uint16_t>(length);
+        this->timeStampLength = static_cast<std::uint8_t>(stampLength);
+        this->source = static_cast<std::uint8_t>(source);
+        this->severity = static_cast<std::uint8_t>(severity);
+        this->flags = value ? FLAG_HAS_VALUE : 0;
+        std::memcpy(this->timeStamp, timeStamp.data(), stampLength);
+        std::memcpy(this->payload, payload.data(), length);
+    }
+
+    void store(const LogMessage &msg) noexcept
+    {
+        store(msg.getSource(), msg.getSeverity(), msg.getTimeStamp(), msg.getPayload(), msg.getValue(), msg.getTime());
+    }
+
+    [[nodiscard]] LogMessage load() const
+    {
+        const auto time = std::chrono::system_clock::time_point(
+            std::chrono::duration_cast<std::chrono::system_clock::duration>(std::chrono::nanoseconds(timeNs)));
+        return LogMessage(getSource(), getSeverity(), std::string(getTimeStamp()), std::string(getPayload()),
+                          flags & FLAG_HAS_VALUE ? std::optional<float>(value) : std::nullopt, time);
+    }
+
+    [[nodiscard]] TelemetrySrc getSource() const noexcept { return static_cast<TelemetrySrc>(source); }
+    [[nodiscard]] SeverityLvl getSeverity() const noexcept { return static_cast<SeverityLvl>(severity); }
+    [[nodiscard]] std::string_view getTimeStamp() const noexcept { return {timeStamp, timeStampLength}; }
+    [[nodiscard]] std::string_view getPayload() const noexcept { return {payload, payloadLength}; }
+};
+
+static_assert(sizeof(LogRecordSlot) == LogRecordSlot::SLOT_BYTES);
@@ -0,0 +1,110 @@
+#include "RealtimeRing.hpp"
+#include <bit>
+#include <new>
+#include <sys/mman.h>
+#include <utility>
+
+std::size_t RealtimeRing::bytesFor(std::size_t capacity)
+{
+    // Slots start on the first SLOT_BYTES boundary after the header
+    const std::size_t headerBytes = (sizeof(Header) + SLOT_BYTES - 1) / SLOT_BYTES * SLOT_BYTES;
+    return headerBytes + capacity * SLOT_BYTES;
+}
+
+RealtimeRing::RealtimeRing(void *mapping, std::size_t mappedBytes, std::size_t capacity)
+    : header(static_cast<Header *>(mapping)),
+      queue(header->head, header->tail,
+            reinterpret_cast<LogRecordSlot *>(static_cast<char *>(mapping) + bytesFor(0)), capacity),
+      mappedBytes(mappedBytes)
+{
+}
+
+std::expected<RealtimeRing, RealtimeRingError> RealtimeRing::create(std::size_t capacity)
+{
+    if (capacity < 2 || !std::has_single_bit(capacity) || capacity > SlotQueue<LogRecordSlot>::MAX_CAPACITY)
+    {
+        return std::unexpected(RealtimeRingError::INVALID_CAPACITY);
+    }
+
+    // MAP_POPULATE faults every page in now rather than on a producer's first push
+    const std::size_t bytes = bytesFor(capacity);
+    void *mapping = ::mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_POPULATE, -1, 0);
+    if (mapping == MAP_FAILED)
+    {
+        return std::unexpected(RealtimeRingError::ALLOCATION_FAILED);
+    }
+    if (::mlock(mapping, bytes) != 0)
+    {
+        ::munmap(mapping, bytes);
+        return std::unexpected(RealtimeRingError::LOCK_FAILED);
+    }
+
+    auto *header = static_cast<Header *>(mapping);
+    new (&header->dropped) std::atomic<std::uint64_t>(0);
+
+    RealtimeRing ring(mapping, bytes, capacity);
+    ring.queue.reset();
+    return ring;
+}
+
+RealtimeRing::~RealtimeRing()
+{
+    if (header)
+    {
+        ::munmap(header, mappedBytes);  // also unlocks the pages
+    }
+}
+
+RealtimeRing::RealtimeRing(RealtimeRing &&other) noexcept
+    : header(std::exchange(other.header, nullptr)),
+      queue(std::exchange(other.queue, {})),
+      mappedBytes(std::exchange(other.mappedBytes, 0))
+{
+}
+
+RealtimeRing &RealtimeRing::operator=(RealtimeRing &&other) noexcept
+{
+    if (this != &other)
+    {
+        if (header)
+        {
+            ::munmap(header, mappedBytes);
+        }
+        header = std::exchange(other.header, nullptr);
+        queue = std::exchange(other.queue, {});
+        mappedBytes = std::exchange(other.mappedBytes, 0);
+    }
+    return *this;
+}
+
+bool RealtimeRing::tryPush(TelemetrySrc source, SeverityLvl severity, std::string_view timeStamp,
+                           std::string_view payload, std::optional<float> value,
+                           std::chrono::system_clock::time_point time) noexcept
+{
+    std::uint64_t pos = 0;
+    LogRecordSlot *slot = queue.claim(OWNER, pos);
+    if (!slot)
+    {
+        header->dropped.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+    slot->store(source, severity, timeStamp, payload, value, time);
+    return queue.publish(*slot, pos, OWNER);
+}
+
+std::optional<LogMessage> RealtimeRing::tryPop()
+{
+    const LogRecordSlot *slot = queue.front();
+    if (!slot)
+    {
+        return std::nullopt;
+    }
+    std::optional<LogMessage> msg(slot->load());
+    queue.pop();
+    return msg;
+}
+
+std::uint64_t RealtimeRing::dropped() const noexcept
+{
+    return header->dropped.load(std::memory_order_relaxed);
+}
@@ -0,0 +1,92 @@
+#pragma once
+
+#include "LogMessage.hpp"
+#include "LogRecordSlot.hpp"
+#include "SlotQueue.hpp"
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <expected>
+#include <optional>
+#include <string_view>
+
+enum class RealtimeRingError
+{
+    INVALID_CAPACITY,   // must be a power of two
+    ALLOCATION_FAILED,  // mmap failed
+    LOCK_FAILED,        // mlock failed, e.g. RLIMIT_MEMLOCK too low
+};
+
+// Bounded multi-producer / single-consumer ring of fixed-size log records for the
+// real-time profile. Every slot is mapped, pre-faulted and mlock'ed by create(), so
+// pushing never allocates, takes a lock, makes a syscall or page-faults.
+//
+// Same slot protocol and record layout as ShmRing (SlotQueue, LogRecordSlot), but private
+// to the process and without a futex: the consumer polls. A full ring drops the record
+// and counts it. Timestamps and payloads longer than the slot fields are truncated.
+class RealtimeRing
+{
+public:
+    static constexpr std::size_t SLOT_BYTES = LogRecordSlot::SLOT_BYTES;
+    static constexpr std::size_t TIMESTAMP_BYTES = LogRecordSlot::TIMESTAMP_BYTES;
+    static constexpr std::size_t PAYLOAD_BYTES = LogRecordSlot::PAYLOAD_BYTES;
+
+private:
+    struct Header
+    {
+        alignas(64) std::atomic<std::uint64_t> head;  // next slot producers claim
+        alignas(64) std::atomic<std::uint64_t> tail;  // next slot the consumer reads
+        std::atomic<std::uint64_t> dropped;
+    };
+
+    // Producers share one process, and a thread dying mid-push takes it down: any
+    // non-zero owner id will do
+    static constexpr std::uint32_t OWNER = 1;
+
+    Header *header = nullptr;
+    SlotQueue<LogRecordSlot> queue;
+    std::size_t mappedBytes = 0;
+
+    RealtimeRing(void *mapping, std::size_t mappedBytes, std::size_t capacity);
+    static std::size_t bytesFor(std::size_t capacity);
+
+public:
+    static std::expected<RealtimeRing, RealtimeRingError> create(std::size_t capacity);
+
+    ~RealtimeRing();
+    RealtimeRing(const RealtimeRing &) = delete;
+    RealtimeRing &operator=(const RealtimeRing &) = delete;
+    RealtimeRing(RealtimeRing &&other) noexcept;
+    RealtimeRing &operator=(RealtimeRing &&other) noexcept;
+
+    // Producer: any number of threads. False if the ring was full (counted in dropped()).
+    // 'time' is kept as the message time.
+    [[nodiscard]] bool tryPush(TelemetrySrc source, SeverityLvl severity, std::string_view timeStamp,
+                               std::string_view payload, std::optional<float> value,
+                               std::chrono::system_clock::time_point time) noexcept;
+    [[nodiscard]] bool tryPush(const LogMessage &msg) noexcept
+    {
+        return tryPush(msg.getSource(), msg.getSeverity(), msg.getTimeStamp(), msg.getPayload(), msg.getValue(),
+                       msg.getTime());
+    }
+
+    // Consumer: one thread at a time
+    [[nodiscard]] std::optional<LogMessage> tryPop();
+
+    // Calls fn(source, severity, timeStamp, payload) for every published record, oldest
+    // first, without consuming it. No locks or allocation: usable from a signal handler.
+    template <typename Fn>
+    void forEachUnlocked(Fn &&fn) const noexcept;
+
+    [[nodiscard]] std::size_t capacity() const noexcept { return queue.capacity(); }
+    [[nodiscard]] std::size_t size() const noexcept { return queue.size(); }
+    [[nodiscard]] std::uint64_t dropped() const noexcept;
+};
+
+template <typename Fn>
+void RealtimeRing::forEachUnlocked(Fn &&fn) const noexcept
+{
+    queue.forEachPublished([&fn](const LogRecordSlot &slot) {
+        fn(slot.getSource(), slot.getSeverity(), slot.getTimeStamp(), slot.getPayload());
+    });
+}
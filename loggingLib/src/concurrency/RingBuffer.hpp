@@ -7,6 +7,20 @@
 #include <concepts>
 #include <mutex>
 #include <condition_variable>
+#include <chrono>
+#include <algorithm>
+#include <iterator>
+#include <span>
+#include <cstdint>
+#include <atomic>
+#include "WaitStrategy.hpp"
+
+// What a push does when the buffer is full
+enum class OverflowPolicy
+{
+    REJECT,            // tryPush() fails, push() blocks until there is room
+    OVERWRITE_OLDEST,  // the oldest element is discarded and counted; pushes never fail or block
+};
 
 template <typename T>
 class RingBuffer
@@ -17,13 +31,21 @@ private:
     std::size_t tail = 0;
     std::size_t elemCount = 0;
     std::size_t maxCapacity;
+    OverflowPolicy policy;
+    std::uint64_t overwrittenCount = 0;
     mutable std::mutex bufferMutex;
     std::condition_variable notEmpty;
     std::condition_variable notFull;
+    std::atomic<WaitStrategy> waitStrategy;
+    // Mirrors written under bufferMutex, so spinning poppers and monitoring never take it
+    std::atomic<std::size_t> countHint{0};
+    std::atomic<std::size_t> capacityHint;
+    std::atomic<std::uint64_t> overwrittenHint{0};
 
 public:
-    explicit RingBuffer(std::size_t capacity)
-        : buffer(capacity), maxCapacity(capacity)
+    explicit RingBuffer(std::size_t capacity, OverflowPolicy policy = OverflowPolicy::REJECT,
+                        WaitStrategy wait = WaitStrategy::BLOCK)
+        : buffer(capacity), maxCapacity(capacity), policy(policy), waitStrategy(wait), capacityHint(capacity)
     {
     }
 
@@ -35,7 +57,7 @@ public:
 
     // Move constructor
     RingBuffer(RingBuffer &&other) noexcept
-        : maxCapacity(0)
+        : maxCapacity(0), policy(other.policy), waitStrategy(other.waitStrategy.load()), capacityHint(0)
     {
         std::lock_guard<std::mutex> lock(other.bufferMutex);
         buffer = std::move(other.buffer);
@@ -43,6 +65,12 @@ public:
         tail = other.tail;
         elemCount = other.elemCount;
         maxCapacity = other.maxCapacity;
+        overwrittenCount = other.overwrittenCount;
+        countHint.store(elemCount, std::memory_order_relaxed);
+        capacityHint.store(maxCapacity, std::memory_order_relaxed);
+        overwrittenHint.store(overwrittenCount, std::memory_order_relaxed);
+        other.countHint.store(0, std::memory_order_relaxed);
+        other.capacityHint.store(0, std::memory_order_relaxed);
         
         other.head = 0;
         other.tail = 0;
@@ -58,11 +86,9 @@ public:
     void push(U &&value)
     {
         std::unique_lock<std::mutex> lock(bufferMutex);
-        notFull.wait(lock, [this]() { return !isFull_unlocked(); });
+        notFull.wait(lock, [this]() { return !isFull_unlocked() || policy == OverflowPolicy::OVERWRITE_OLDEST; });
         
-        buffer[head] = std::forward<U>(value);
-        head = (head + 1) % maxCapacity;
-        ++elemCount;
+        emplace_unlocked(std::forward<U>(value));
         
         lock.unlock();
         notEmpty.notify_one();
@@ -74,27 +100,83 @@ public:
     [[nodiscard]] bool tryPush(U &&value)
     {
         std::lock_guard<std::mutex> lock(bufferMutex);
-        if (isFull_unlocked())
+        if (isFull_unlocked() && policy == OverflowPolicy::REJECT)
         {
             return false;
         }
-        buffer[head] = std::forward<U>(value);
-        head = (head + 1) % maxCapacity;
-        ++elemCount;
+        emplace_unlocked(std::forward<U>(value));
         notEmpty.notify_one();
         return true;
     }
 
-    // Blocking pop
+    // Non-blocking in-place push: constructs T from 'args' directly in the slot, so
+    // forwarded rvalues are moved once and nothing is copied. Arguments are left
+    // untouched when it returns false.
+    template <typename... Args>
+        requires std::constructible_from<T, Args...>
+    [[nodiscard]] bool tryEmplace(Args &&...args)
+    {
+        std::lock_guard<std::mutex> lock(bufferMutex);
+        if (isFull_unlocked() && policy == OverflowPolicy::REJECT)
+        {
+            return false;
+        }
+        emplace_unlocked(std::forward<Args>(args)...);
+        notEmpty.notify_one();
+        return true;
+    }
+
+    // Non-blocking bulk push: moves the leading elements of 'values' that fit, under one
+    // lock and with one notify. Returns how many were taken; the rest are left untouched.
+    // With OVERWRITE_OLDEST all are taken; only the newest capacity() of them survive.
+    [[nodiscard]] std::size_t tryPushN(std::span<T> values)
+    {
+        std::size_t pushed = 0;
+        {
+            std::lock_guard<std::mutex> lock(bufferMutex);
+            if (policy == OverflowPolicy::OVERWRITE_OLDEST)
+            {
+                // Elements that would be overwritten within this batch are never stored
+                const std::size_t skipped = values.size() > maxCapacity ? values.size() - maxCapacity : 0;
+                overwrittenCount += skipped;
+                overwrittenHint.store(overwrittenCount, std::memory_order_relaxed);
+                for (std::size_t i = skipped; i < values.size(); ++i)
+                {
+                    emplace_unlocked(std::move(values[i]));
+                }
+                pushed = values.size();
+            }
+            else
+            {
+                pushed = std::min(values.size(), maxCapacity - elemCount);
+                for (std::size_t i = 0; i < pushed; ++i)
+                {
+                    emplace_unlocked(std::move(values[i]));
+                }
+            }
+        }
+        if (pushed > 1)
+        {
+            notEmpty.notify_all();
+        }
+        else if (pushed == 1)
+        {
+            notEmpty.notify_one();
+        }
+        return pushed;
+    }
+
+    // Blocking pop; waits as set by the WaitStrategy
     [[nodiscard]] T pop()
     {
         std::unique_lock<std::mutex> lock(bufferMutex);
-        notEmpty.wait(lock, [this]() { return !isEmpty_unlocked(); });
+        waitNotEmpty_unlocked(lock, std::chrono::steady_clock::time_point::max());
         
         T value = std::move(buffer[tail].value());
         buffer[tail].reset();
         tail = (tail + 1) % maxCapacity;
         --elemCount;
+        countHint.store(elemCount, std::memory_order_relaxed);
         
         lock.unlock();
         notFull.notify_one();
@@ -113,10 +195,57 @@ public:
         buffer[tail].reset();
         tail = (tail + 1) % maxCapacity;
         --elemCount;
+        countHint.store(elemCount, std::memory_order_relaxed);
         notFull.notify_one();
         return value;
     }
 
+    // Non-blocking bulk pop: moves up to 'maxCount' elements, oldest first, to 'out'
+    // (e.g. span.begin(), or std::back_inserter on a vector with reserved capacity),
+    // under one lock and with one notify. Returns how many were popped.
+    template <std::output_iterator<T> OutputIt>
+    std::size_t tryPopN(OutputIt out, std::size_t maxCount)
+    {
+        std::size_t popped = 0;
+        {
+            std::lock_guard<std::mutex> lock(bufferMutex);
+            popped = std::min(maxCount, elemCount);
+            for (std::size_t i = 0; i < popped; ++i)
+            {
+                *out = std::move(buffer[tail].value());
+                ++out;
+                buffer[tail].reset();
+                tail = (tail + 1) % maxCapacity;
+            }
+            elemCount -= popped;
+            countHint.store(elemCount, std::memory_order_relaxed);
+        }
+        if (popped > 1)
+        {
+            notFull.notify_all();
+        }
+        else if (popped == 1)
+        {
+            notFull.notify_one();
+        }
+        return popped;
+    }
+
+    // Blocks until an element is available or 'timeout' passes; true if one is.
+    // Does not pop, so a consumer can take its own locks before draining.
+    bool waitNotEmpty(std::chrono::milliseconds timeout)
+    {
+        const auto deadline = std::chrono::steady_clock::now() + timeout;
+        std::unique_lock<std::mutex> lock(bufferMutex);
+        return waitNotEmpty_unlocked(lock, deadline);
+    }
+
+    // Applies to pop() and waitNotEmpty() calls that start afterwards
+    void setWaitStrategy(WaitStrategy strategy) noexcept
+    {
+        waitStrategy.store(strategy, std::memory_order_relaxed);
+    }
+
     [[nodiscard]] bool isEmpty() const noexcept
     {
         std::lock_guard<std::mutex> lock(bufferMutex);
@@ -129,18 +258,112 @@ public:
         return isFull_unlocked();
     }
 
+    // count(), capacity() and overwritten() read the mirrors: lock-free, so stats and
+    // metrics scrapes never contend with producers. They can lag a concurrent call by one.
     [[nodiscard]] std::size_t count() const noexcept
     {
-        std::lock_guard<std::mutex> lock(bufferMutex);
-        return elemCount;
+        return countHint.load(std::memory_order_relaxed);
     }
 
     [[nodiscard]] std::size_t capacity() const noexcept
     {
-        return maxCapacity;
+        return capacityHint.load(std::memory_order_relaxed);
+    }
+
+    // Changes the capacity in place, keeping every element and their order. Fails if
+    // more elements are buffered than 'newCapacity' holds, or for 0; pop and retry.
+    bool resize(std::size_t newCapacity)
+    {
+        {
+            std::lock_guard<std::mutex> lock(bufferMutex);
+            if (newCapacity == 0 || newCapacity < elemCount)
+            {
+                return false;
+            }
+            std::vector<std::optional<T>> resized(newCapacity);
+            for (std::size_t i = 0; i < elemCount; ++i)
+            {
+                resized[i] = std::move(buffer[(tail + i) % maxCapacity]);
+            }
+            buffer = std::move(resized);
+            tail = 0;
+            head = elemCount % newCapacity;
+            maxCapacity = newCapacity;
+            capacityHint.store(newCapacity, std::memory_order_relaxed);
+        }
+        notFull.notify_all();
+        return true;
+    }
+
+    [[nodiscard]] OverflowPolicy overflowPolicy() const noexcept
+    {
+        return policy;
+    }
+
+    // Elements discarded by OVERWRITE_OLDEST since construction
+    [[nodiscard]] std::uint64_t overwritten() const noexcept
+    {
+        return overwrittenHint.load(std::memory_order_relaxed);
+    }
+
+    // Visits buffered elements oldest-first WITHOUT taking the mutex.
+    // Only meant for crash handlers, where locking is not an option and a
+    // concurrently modified slot is an acceptable risk.
+    template <typename Fn>
+    void forEachUnlocked(Fn &&fn) const noexcept
+    {
+        std::size_t index = tail;
+        for (std::size_t i = 0; i < elemCount && i < maxCapacity; ++i)
+        {
+            if (buffer[index].has_value())
+            {
+                fn(*buffer[index]);
+            }
+            index = (index + 1) % maxCapacity;
+        }
     }
 
 private:
+    // Caller holds 'lock' on bufferMutex; it is released while spinning
+    bool waitNotEmpty_unlocked(std::unique_lock<std::mutex> &lock, std::chrono::steady_clock::time_point deadline)
+    {
+        const WaitStrategy strategy = waitStrategy.load(std::memory_order_relaxed);
+        while (isEmpty_unlocked() && strategy != WaitStrategy::BLOCK)
+        {
+            lock.unlock();
+            const bool seen = spinWait(strategy, [this]() { return countHint.load(std::memory_order_relaxed) != 0; },
+                                       deadline);
+            lock.lock();
+            if (!seen)
+            {
+                break;  // spin budget spent or deadline passed: park below
+            }
+        }
+        if (deadline == std::chrono::steady_clock::time_point::max())
+        {
+            notEmpty.wait(lock, [this]() { return !isEmpty_unlocked(); });
+            return true;
+        }
+        return notEmpty.wait_until(lock, deadline, [this]() { return !isEmpty_unlocked(); });
+    }
+
+    // Caller holds bufferMutex and has checked the policy allows a push when full
+    template <typename... Args>
+    void emplace_unlocked(Args &&...args)
+    {
+        if (isFull_unlocked())
+        {
+            tail = (tail + 1) % maxCapacity;  // the slot at head is the oldest; assigned below
+            --elemCount;
+            ++overwrittenCount;
+            overwrittenHint.store(overwrittenCount, std::memory_order_relaxed);
+        }
+        buffer[head].emplace(std::forward<Args>(args)...);
+        head = (head + 1) % maxCapacity;
+        ++elemCount;
+        countHint.store(elemCount, std::memory_order_relaxed);
+    }
+
     [[nodiscard]] bool isEmpty_unlocked() const noexcept
     {
         return elemCount == 0;
@@ -0,0 +1,290 @@
+#include "ShmRing.hpp"
+#include <bit>
+#include <cerrno>
+#include <climits>
+#include <ctime>
+#include <fcntl.h>
+#include <linux/futex.h>
+#include <new>
+#include <pthread.h>
+#include <signal.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <utility>
+
+namespace
+{
+// Shared (not FUTEX_PRIVATE) wait/wake: the word lives in memory mapped by several processes
+void futexWait(std::atomic<std::uint32_t> &word, std::uint32_t expected, std::chrono::milliseconds timeout)
+{
+    timespec ts{};
+    ts.tv_sec = static_cast<time_t>(timeout.count() / 1000);
+    ts.tv_nsec = static_cast<long>((timeout.count() % 1000) * 1000000);
+    ::syscall(SYS_futex, reinterpret_cast<std::uint32_t *>(&word), FUTEX_WAIT, expected, &ts, nullptr, 0);
+}
+
+void futexWake(std::atomic<std::uint32_t> &word)
+{
+    ::syscall(SYS_futex, reinterpret_cast<std::uint32_t *>(&word), FUTEX_WAKE, INT_MAX, nullptr, nullptr, 0);
+}
+
+std::string shmPath(const std::string &name)
+{
+    return name.starts_with('/') ? name : "/" + name;
+}
+
+// The pid stamped on claimed slots, cached so pushes stay syscall-free. A fork() child
+// refreshes it: with its parent's pid, a child dying mid-push would leave a slot the
+// collector thinks is still owned, and the ring would wedge.
+std::atomic<pid_t> processId{0};
+
+void refreshProcessId() noexcept
+{
+    processId.store(::getpid(), std::memory_order_relaxed);
+}
+
+void trackProcessId()
+{
+    static const bool registered = [] {
+        refreshProcessId();
+        ::pthread_atfork(nullptr, nullptr, refreshProcessId);
+        return true;
+    }();
+    static_cast<void>(registered);
+}
+} // namespace
+
+std::size_t ShmRing::bytesFor(std::size_t capacity)
+{
+    // Slots start on the first SLOT_BYTES boundary after the header
+    const std::size_t headerBytes = (sizeof(Header) + SLOT_BYTES - 1) / SLOT_BYTES * SLOT_BYTES;
+    return headerBytes + capacity * SLOT_BYTES;
+}
+
+ShmRing::ShmRing(void *mapping, std::size_t mappedBytes)
+    : header(static_cast<Header *>(mapping)),
+      queue(header->head, header->tail,
+            reinterpret_cast<LogRecordSlot *>(static_cast<char *>(mapping) + bytesFor(0)), header->capacity),
+      mappedBytes(mappedBytes)
+{
+    trackProcessId();
+}
+
+std::expected<ShmRing, ShmRingError> ShmRing::create(const std::string &name, std::size_t capacity)
+{
+    if (capacity < 2 || !std::has_single_bit(capacity) || capacity > MAX_CAPACITY)
+    {
+        return std::unexpected(ShmRingError::INVALID_CAPACITY);
+    }
+
+    const int fd = ::shm_open(shmPath(name).c_str(), O_CREAT | O_RDWR | O_CLOEXEC, 0660);
+    if (fd < 0)
+    {
+        return std::unexpected(ShmRingError::OPEN_FAILED);
+    }
+
+    const std::size_t bytes = bytesFor(capacity);
+    struct stat info{};
+    const bool fresh = ::fstat(fd, &info) == 0 && info.st_size == 0;
+    if ((fresh && ::ftruncate(fd, static_cast<off_t>(bytes)) != 0) ||
+        (!fresh && static_cast<std::size_t>(info.st_size) != bytes))
+    {
+        ::close(fd);
+        return std::unexpected(fresh ? ShmRingError::OPEN_FAILED : ShmRingError::LAYOUT_MISMATCH);
+    }
+
+    void *mapping = ::mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (mapping == MAP_FAILED)
+    {
+        return std::unexpected(ShmRingError::OPEN_FAILED);
+    }
+
+    auto *header = static_cast<Header *>(mapping);
+    if (header->magic.load(std::memory_order_acquire) == MAGIC)
+    {
+        // Collector restart: keep records producers queued in the meantime
+        if (header->version != VERSION || header->capacity != capacity)
+        {
+            ::munmap(mapping, bytes);
+            return std::unexpected(ShmRingError::LAYOUT_MISMATCH);
+        }
+        return ShmRing(mapping, bytes);
+    }
+
+    header->version = VERSION;
+    header->capacity = static_cast<std::uint32_t>(capacity);
+    new (&header->wakeWord) std::atomic<std::uint32_t>(0);
+    new (&header->collectorWaiting) std::atomic<std::uint32_t>(0);
+    new (&header->dropped) std::atomic<std::uint64_t>(0);
+    new (&header->abandoned) std::atomic<std::uint64_t>(0);
+
+    ShmRing ring(mapping, bytes);
+    ring.queue.reset();
+    // Producers treat the segment as usable once the magic is visible
+    header->magic.store(MAGIC, std::memory_order_release);
+    return ring;
+}
+
+std::expected<ShmRing, ShmRingError> ShmRing::attach(const std::string &name)
+{
+    const int fd = ::shm_open(shmPath(name).c_str(), O_RDWR | O_CLOEXEC, 0);
+    if (fd < 0)
+    {
+        return std::unexpected(ShmRingError::OPEN_FAILED);
+    }
+
+    struct stat info{};
+    if (::fstat(fd, &info) != 0 || static_cast<std::size_t>(info.st_size) < bytesFor(0))
+    {
+        ::close(fd);
+        return std::unexpected(ShmRingError::OPEN_FAILED);
+    }
+
+    const auto bytes = static_cast<std::size_t>(info.st_size);
+    void *mapping = ::mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (mapping == MAP_FAILED)
+    {
+        return std::unexpected(ShmRingError::OPEN_FAILED);
+    }
+
+    auto *header = static_cast<Header *>(mapping);
+    if (header->magic.load(std::memory_order_acquire) != MAGIC)
+    {
+        ::munmap(mapping, bytes);
+        return std::unexpected(ShmRingError::OPEN_FAILED);
+    }
+    if (header->version != VERSION || bytesFor(header->capacity) != bytes)
+    {
+        ::munmap(mapping, bytes);
+        return std::unexpected(ShmRingError::LAYOUT_MISMATCH);
+    }
+    return ShmRing(mapping, bytes);
+}
+
+bool ShmRing::unlink(const std::string &name)
+{
+    return ::shm_unlink(shmPath(name).c_str()) == 0;
+}
+
+ShmRing::~ShmRing()
+{
+    if (header)
+    {
+        ::munmap(header, mappedBytes);
+    }
+}
+
+ShmRing::ShmRing(ShmRing &&other) noexcept
+    : header(std::exchange(other.header, nullptr)),
+      queue(std::exchange(other.queue, {})),
+      mappedBytes(std::exchange(other.mappedBytes, 0))
+{
+}
+
+ShmRing &ShmRing::operator=(ShmRing &&other) noexcept
+{
+    if (this != &other)
+    {
+        if (header)
+        {
+            ::munmap(header, mappedBytes);
+        }
+        header = std::exchange(other.header, nullptr);
+        queue = std::exchange(other.queue, {});
+        mappedBytes = std::exchange(other.mappedBytes, 0);
+    }
+    return *this;
+}
+
+bool ShmRing::tryPush(const LogMessage &msg) noexcept
+{
+    const auto owner = static_cast<std::uint32_t>(processId.load(std::memory_order_relaxed));
+    std::uint64_t pos = 0;
+    LogRecordSlot *slot = queue.claim(owner, pos);
+    if (!slot)
+    {
+        header->dropped.fetch_add(1, std::memory_order_relaxed);
+        return false;  // full: the collector has not released this slot yet
+    }
+    slot->store(msg);
+
+    // seq_cst orders the publish before the collectorWaiting check (pairs with waitForData).
+    // Fails if the collector took this process for dead and skipped the slot.
+    if (!queue.publish(*slot, pos, owner, std::memory_order_seq_cst))
+    {
+        return false;  // counted in abandoned()
+    }
+    if (header->collectorWaiting.load(std::memory_order_seq_cst) != 0)
+    {
+        wakeCollector();
+    }
+    return true;
+}
+
+std::optional<LogMessage> ShmRing::tryPop()
+{
+    const LogRecordSlot *slot = queue.front();
+    if (!slot)
+    {
+        return std::nullopt;
+    }
+    std::optional<LogMessage> msg(slot->load());
+    queue.pop();
+    return msg;
+}
+
+bool ShmRing::waitForData(std::chrono::milliseconds timeout)
+{
+    const std::uint32_t word = header->wakeWord.load(std::memory_order_acquire);
+    header->collectorWaiting.store(1, std::memory_order_seq_cst);
+    if (queue.front(std::memory_order_seq_cst))
+    {
+        header->collectorWaiting.store(0, std::memory_order_relaxed);
+        return true;
+    }
+
+    futexWait(header->wakeWord, word, timeout);
+    header->collectorWaiting.store(0, std::memory_order_relaxed);
+
+    if (queue.front())
+    {
+        return true;
+    }
+    return reclaimAbandonedSlot();
+}
+
+bool ShmRing::reclaimAbandonedSlot()
+{
+    // Claimed but unpublished: skip it only if the claiming process no longer exists
+    const auto owner = static_cast<pid_t>(queue.stalledOwner());
+    if (owner == 0 || ::kill(owner, 0) == 0 || errno != ESRCH)
+    {
+        return false;
+    }
+    if (!queue.skip(static_cast<std::uint32_t>(owner)))
+    {
+        return false;
+    }
+    header->abandoned.fetch_add(1, std::memory_order_relaxed);
+    return true;
+}
+
+void ShmRing::wakeCollector() noexcept
+{
+    header->wakeWord.fetch_add(1, std::memory_order_release);
+    futexWake(header->wakeWord);
+}
+
+std::uint64_t ShmRing::dropped() const noexcept
+{
+    return header->dropped.load(std::memory_order_relaxed);
+}
+
+std::uint64_t ShmRing::abandoned() const noexcept
+{
+    return header->abandoned.load(std::memory_order_relaxed);
+}
@@ -0,0 +1,99 @@
+#pragma once
+
+#include "LogMessage.hpp"
+#include "LogRecordSlot.hpp"
+#include "SlotQueue.hpp"
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <expected>
+#include <optional>
+#include <string>
+
+enum class ShmRingError
+{
+    INVALID_CAPACITY,  // must be a power of two
+    OPEN_FAILED,       // shm_open/ftruncate/mmap failed, or no collector created the ring yet
+    LAYOUT_MISMATCH,   // existing segment has another version or capacity
+};
+
+// Bounded multi-producer / single-consumer ring of fixed-size log records in POSIX
+// shared memory (/dev/shm/<name>), shared between processes.
+//
+// Producers claim and publish slots with the SlotQueue protocol, so pushing makes no
+// syscalls unless the collector is asleep, in which case one FUTEX_WAKE is issued. A full
+// ring drops the record and counts it. Records use the LogRecordSlot layout, shared with
+// RealtimeRing; fields longer than the slot are truncated.
+//
+// A slot's owner is the pid of the producer filling it, stamped by the claim itself. A
+// producer killed between claiming and publishing would block the ring; the collector
+// detects that (owner pid gone) when a wait times out and skips the slot.
+//
+// The pid is cached per process and refreshed by a pthread_atfork() child handler, so a
+// ring (or ShmLogProducer) may be used on both sides of a fork(). Children made without
+// fork() (vfork, raw clone) must exec or attach() again before pushing.
+class ShmRing
+{
+public:
+    static constexpr std::size_t SLOT_BYTES = LogRecordSlot::SLOT_BYTES;
+    static constexpr std::size_t TIMESTAMP_BYTES = LogRecordSlot::TIMESTAMP_BYTES;
+    static constexpr std::size_t PAYLOAD_BYTES = LogRecordSlot::PAYLOAD_BYTES;
+    static constexpr std::size_t MAX_CAPACITY = SlotQueue<LogRecordSlot>::MAX_CAPACITY;
+
+private:
+    struct Header
+    {
+        std::atomic<std::uint64_t> magic;  // stored last by create(); zero in a fresh segment
+        std::uint32_t version;
+        std::uint32_t capacity;
+        alignas(64) std::atomic<std::uint64_t> head;      // next slot producers claim
+        alignas(64) std::atomic<std::uint64_t> tail;      // next slot the collector reads
+        alignas(64) std::atomic<std::uint32_t> wakeWord;  // futex word, bumped on wake-ups
+        std::atomic<std::uint32_t> collectorWaiting;
+        std::atomic<std::uint64_t> dropped;
+        std::atomic<std::uint64_t> abandoned;
+    };
+
+    static_assert(std::atomic<std::uint64_t>::is_always_lock_free &&
+                  std::atomic<std::uint32_t>::is_always_lock_free,
+                  "shared-memory atomics must not rely on process-local locks");
+
+    static constexpr std::uint64_t MAGIC = 0x474E49524D48534CULL;  // "LSHMRING"
+    static constexpr std::uint32_t VERSION = 3;
+
+    Header *header = nullptr;
+    SlotQueue<LogRecordSlot> queue;
+    std::size_t mappedBytes = 0;
+
+    ShmRing(void *mapping, std::size_t mappedBytes);
+    static std::size_t bytesFor(std::size_t capacity);
+    bool reclaimAbandonedSlot();
+
+public:
+    // Collector side: creates the segment, or reuses one with the same layout
+    static std::expected<ShmRing, ShmRingError> create(const std::string &name, std::size_t capacity);
+    // Producer side: maps a segment the collector already created
+    static std::expected<ShmRing, ShmRingError> attach(const std::string &name);
+    static bool unlink(const std::string &name);
+
+    ~ShmRing();
+    ShmRing(const ShmRing &) = delete;
+    ShmRing &operator=(const ShmRing &) = delete;
+    ShmRing(ShmRing &&other) noexcept;
+    ShmRing &operator=(ShmRing &&other) noexcept;
+
+    // Producer: any number of threads in any number of processes
+    [[nodiscard]] bool tryPush(const LogMessage &msg) noexcept;
+
+    // Collector: exactly one thread in one process
+    [[nodiscard]] std::optional<LogMessage> tryPop();
+    // Sleeps on the futex until a record is published or 'timeout' passes; true if one is ready
+    bool waitForData(std::chrono::milliseconds timeout);
+    // Wakes a collector blocked in waitForData() (e.g. for shutdown)
+    void wakeCollector() noexcept;
+
+    [[nodiscard]] std::size_t capacity() const noexcept { return queue.capacity(); }
+    [[nodiscard]] std::size_t size() const noexcept { return queue.size(); }
+    [[nodiscard]] std::uint64_t dropped() const noexcept;
+    [[nodiscard]] std::uint64_t abandoned() const noexcept;
+};
@@ -0,0 +1,180 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+
+// The slot protocol behind ShmRing and RealtimeRing: a bounded multi-producer /
+// single-consumer queue (Vyukov's bounded queue) over memory the caller provides, so
+// head, tail and the slots may live in a shared-memory segment.
+//
+// Each slot's 'state' word holds a sequence number in the high half and the id of the
+// producer filling it in the low half (0: none). A producer claims slot 'pos' by CASing
+// (pos, 0) to (pos, owner), so a claimed slot always names its owner, then moves head past
+// it; others help if it stalls there. Publishing stores (pos + 1, 0) and the consumer
+// hands the slot to the next lap with (pos + capacity, 0), which clears the owner again.
+// Sequence numbers are 32-bit, hence MAX_CAPACITY.
+//
+// Slot needs a std::atomic<std::uint64_t> 'state' member; the rest of it is the caller's.
+template <typename Slot>
+class SlotQueue
+{
+private:
+    std::atomic<std::uint64_t> *head = nullptr;  // next slot producers claim
+    std::atomic<std::uint64_t> *tail = nullptr;  // next slot the consumer reads
+    Slot *slots = nullptr;
+    std::uint64_t mask = 0;
+
+    static constexpr std::uint64_t stateOf(std::uint64_t sequence, std::uint32_t owner) noexcept
+    {
+        return (sequence << 32) | owner;
+    }
+
+    static constexpr std::uint32_t sequenceOf(std::uint64_t state) noexcept
+    {
+        return static_cast<std::uint32_t>(state >> 32);
+    }
+
+    static constexpr std::uint32_t ownerOf(std::uint64_t state) noexcept
+    {
+        return static_cast<std::uint32_t>(state);
+    }
+
+    void helpHeadPast(std::uint64_t pos) noexcept
+    {
+        std::uint64_t expected = pos;
+        head->compare_exchange_strong(expected, pos + 1, std::memory_order_relaxed);
+    }
+
+public:
+    static constexpr std::size_t MAX_CAPACITY = std::size_t{1} << 30;
+
+    SlotQueue() = default;
+    SlotQueue(std::atomic<std::uint64_t> &head, std::atomic<std::uint64_t> &tail, Slot *slots,
+              std::size_t capacity) noexcept
+        : head(&head), tail(&tail), slots(slots), mask(capacity - 1)
+    {
+    }
+
+    // Constructs the indices and every slot's state in fresh memory; not thread-safe
+    void reset() noexcept
+    {
+        new (head) std::atomic<std::uint64_t>(0);
+        new (tail) std::atomic<std::uint64_t>(0);
+        for (std::uint64_t i = 0; i <= mask; ++i)
+        {
+            new (&slots[i].state) std::atomic<std::uint64_t>(stateOf(i, 0));
+        }
+    }
+
+    // Producer: claims the next slot for 'owner' (non-zero) and sets 'pos' to its
+    // position; nullptr if the ring is full
+    [[nodiscard]] Slot *claim(std::uint32_t owner, std::uint64_t &pos) noexcept
+    {
+        pos = head->load(std::memory_order_relaxed);
+        while (true)
+        {
+            Slot &slot = slots[pos & mask];
+            std::uint64_t state = slot.state.load(std::memory_order_acquire);
+            const auto diff = static_cast<std::int32_t>(sequenceOf(state) - static_cast<std::uint32_t>(pos));
+            if (diff == 0 && ownerOf(state) == 0)
+            {
+                if (slot.state.compare_exchange_weak(state, stateOf(pos, owner), std::memory_order_acquire,
+                                                     std::memory_order_relaxed))
+                {
+                    helpHeadPast(pos);
+                    return &slot;
+                }
+            }
+            else if (diff == 0)
+            {
+                helpHeadPast(pos);  // claimed by a producer that has not moved head past it yet
+            }
+            else if (diff < 0)
+            {
+                return nullptr;  // full: the consumer has not released this slot yet
+            }
+            pos = head->load(std::memory_order_relaxed);
+        }
+    }
+
+    // Producer: makes a claimed slot visible to the consumer. A CAS rather than a store:
+    // false if the consumer skipped the slot meanwhile (see skip()).
+    bool publish(Slot &slot, std::uint64_t pos, std::uint32_t owner,
+                 std::memory_order order = std::memory_order_release) noexcept
+    {
+        std::uint64_t claimed = stateOf(pos, owner);
+        return slot.state.compare_exchange_strong(claimed, stateOf(pos + 1, 0), order, std::memory_order_relaxed);
+    }
+
+    // Consumer: the published slot at the tail, or nullptr
+    [[nodiscard]] Slot *front(std::memory_order order = std::memory_order_acquire) const noexcept
+    {
+        const std::uint64_t pos = tail->load(std::memory_order_relaxed);
+        Slot &slot = slots[pos & mask];
+        return slot.state.load(order) == stateOf(pos + 1, 0) ? &slot : nullptr;
+    }
+
+    // Consumer: hands the slot front() returned back to producers for the next lap
+    void pop() noexcept
+    {
+        const std::uint64_t pos = tail->load(std::memory_order_relaxed);
+        slots[pos & mask].state.store(stateOf(pos + mask + 1, 0), std::memory_order_release);
+        tail->store(pos + 1, std::memory_order_release);
+    }
+
+    // Consumer: the producer holding the tail slot claimed but unpublished, or 0
+    [[nodiscard]] std::uint32_t stalledOwner() const noexcept
+    {
+        const std::uint64_t pos = tail->load(std::memory_order_relaxed);
+        const std::uint64_t state = slots[pos & mask].state.load(std::memory_order_acquire);
+        return sequenceOf(state) == static_cast<std::uint32_t>(pos) ? ownerOf(state) : 0;
+    }
+
+    // Consumer: skips the tail slot if 'owner' still holds it unpublished, e.g. because
+    // that producer died. Its late publish() then fails rather than reviving the slot.
+    bool skip(std::uint32_t owner) noexcept
+    {
+        const std::uint64_t pos = tail->load(std::memory_order_relaxed);
+        Slot &slot = slots[pos & mask];
+        std::uint64_t claimed = stateOf(pos, owner);
+        if (owner == 0 || slot.state.load(std::memory_order_relaxed) != claimed)
+        {
+            return false;
+        }
+        helpHeadPast(pos);  // the producer may have stopped before moving head
+        if (!slot.state.compare_exchange_strong(claimed, stateOf(pos + mask + 1, 0), std::memory_order_acq_rel))
+        {
+            return false;
+        }
+        tail->store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Calls fn(slot) for every published slot from the tail on, oldest first, without
+    // consuming it; stops at the first unpublished one. No locks: signal-handler safe.
+    template <typename Fn>
+    void forEachPublished(Fn &&fn) const noexcept
+    {
+        const std::uint64_t end = head->load(std::memory_order_acquire);
+        for (std::uint64_t pos = tail->load(std::memory_order_acquire); pos != end; ++pos)
+        {
+            const Slot &slot = slots[pos & mask];
+            if (slot.state.load(std::memory_order_acquire) != stateOf(pos + 1, 0))
+            {
+                break;
+            }
+            fn(slot);
+        }
+    }
+
+    [[nodiscard]] std::size_t capacity() const noexcept { return mask + 1; }
+
+    [[nodiscard]] std::size_t size() const noexcept
+    {
+        const std::uint64_t h = head->load(std::memory_order_relaxed);
+        const std::uint64_t t = tail->load(std::memory_order_relaxed);
+        return h > t ? static_cast<std::size_t>(h - t) : 0;
+    }
+};
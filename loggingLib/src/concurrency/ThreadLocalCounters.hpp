@@ -0,0 +1,154 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+// A fixed set of N counters, sharded per thread.
+// add() touches only the calling thread's own cache line (no lock, no shared
+// atomic RMW); readers sum every thread's block. When a thread exits, its counts
+// are folded into a retired total and its block is reused by the next new thread,
+// so memory follows the number of live threads and totals never go backwards.
+template <std::size_t N>
+class ThreadLocalCounters
+{
+private:
+    struct alignas(64) Block
+    {
+        std::array<std::atomic<std::uint64_t>, N> values{};
+    };
+
+    // Shared with the threads holding blocks, which may outlive the counters
+    struct Registry
+    {
+        std::mutex mutex;
+        std::vector<std::unique_ptr<Block>> blocks;  // every block, in use or spare
+        std::vector<Block *> spare;                  // zeroed, from exited threads
+        std::array<std::uint64_t, N> retired{};      // what exited threads counted
+
+        Block *acquire()
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (!spare.empty())
+            {
+                Block *block = spare.back();
+                spare.pop_back();
+                return block;
+            }
+            blocks.push_back(std::make_unique<Block>());
+            return blocks.back().get();
+        }
+
+        // The owning thread has exited: nobody writes the block any more
+        void release(Block *block)
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            for (std::size_t i = 0; i < N; ++i)
+            {
+                retired[i] += block->values[i].exchange(0, std::memory_order_relaxed);
+            }
+            spare.push_back(block);
+        }
+    };
+
+    // The blocks one thread holds, keyed by instance id; handed back when it exits
+    struct ThreadBlocks
+    {
+        std::unordered_map<std::uint64_t, std::pair<std::weak_ptr<Registry>, Block *>> owned;
+
+        ~ThreadBlocks()
+        {
+            cachedId = UINT64_MAX;
+            threadExited = true;
+            for (auto &[id, entry] : owned)
+            {
+                if (auto registry = entry.first.lock())
+                {
+                    registry->release(entry.second);
+                }
+            }
+        }
+    };
+
+    // Fast path, trivially destructible so it stays usable during thread exit
+    static inline thread_local std::uint64_t cachedId = UINT64_MAX;
+    static inline thread_local Block *cached = nullptr;
+    static inline thread_local bool threadExited = false;
+
+    std::shared_ptr<Registry> registry = std::make_shared<Registry>();
+    std::uint64_t id;
+
+    static std::uint64_t nextId() noexcept
+    {
+        static std::atomic<std::uint64_t> counter{0};
+        return counter.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    // nullptr once the thread's blocks were handed back (a late add() from another
+    // thread_local's destructor)
+    Block *localBlock()
+    {
+        // Keyed by instance id rather than address, so a new instance at a
+        // recycled address never picks up a dead instance's block
+        if (cachedId == id)
+        {
+            return cached;
+        }
+        if (threadExited)
+        {
+            return nullptr;
+        }
+
+        thread_local ThreadBlocks mine;
+        auto found = mine.owned.find(id);
+        if (found == mine.owned.end())
+        {
+            std::erase_if(mine.owned, [](const auto &entry) { return entry.second.first.expired(); });
+            found = mine.owned.emplace(id, std::make_pair(std::weak_ptr<Registry>(registry), registry->acquire())).first;
+        }
+        cachedId = id;
+        cached = found->second.second;
+        return cached;
+    }
+
+public:
+    ThreadLocalCounters() : id(nextId()) {}
+
+    ThreadLocalCounters(const ThreadLocalCounters &) = delete;
+    ThreadLocalCounters &operator=(const ThreadLocalCounters &) = delete;
+    ThreadLocalCounters(ThreadLocalCounters &&) = delete;
+    ThreadLocalCounters &operator=(ThreadLocalCounters &&) = delete;
+
+    void add(std::size_t index, std::uint64_t amount = 1)
+    {
+        Block *block = localBlock();
+        if (!block)
+        {
+            std::lock_guard<std::mutex> lock(registry->mutex);
+            registry->retired[index] += amount;
+            return;
+        }
+        // Only this thread writes its block: a plain load/store is enough
+        auto &value = block->values[index];
+        value.store(value.load(std::memory_order_relaxed) + amount, std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] std::array<std::uint64_t, N> snapshot() const
+    {
+        std::lock_guard<std::mutex> lock(registry->mutex);
+        std::array<std::uint64_t, N> totals = registry->retired;
+        for (const auto &block : registry->blocks)
+        {
+            for (std::size_t i = 0; i < N; ++i)
+            {
+                totals[i] += block->values[i].load(std::memory_order_relaxed);
+            }
+        }
+        return totals;
+    }
+};
@@ -7,22 +7,70 @@
 #include <functional>
 #include <mutex>
 #include <condition_variable>
+#include <chrono>
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include "WaitStrategy.hpp"
+#include "utils/Trace.hpp"
+
+// Worker limits. With minThreads == maxThreads the pool is fixed; otherwise it starts
+// at minThreads, grows while tasks wait longer than waitTarget in the queue (checked
+// when a task is picked up and when one is enqueued behind a late one), and a
+// worker idle for idleTimeout leaves as long as more than minThreads remain.
+struct ThreadPoolBounds {
+    std::size_t minThreads = 1;
+    std::size_t maxThreads = 1;
+    std::chrono::microseconds waitTarget{1000};
+    std::chrono::milliseconds idleTimeout{5000};
+};
 
 class ThreadPool{
 
 private:
+    struct Task {
+        std::function<void()> run;
+        std::chrono::steady_clock::time_point queuedAt;
+    };
+
+    static constexpr int WAIT_SMOOTHING = 8;   // queue wait is an EWMA over ~8 tasks
+
     std::vector<std::thread> workers;
-    std::queue<std::function<void()>> tasks;
-    std::mutex taskMutex;
+    std::vector<std::thread> exited;   // workers that left on their own, not yet joined
+    std::queue<Task> tasks;
+    std::queue<Task> priorityTasks;   // always served before 'tasks'
+    mutable std::mutex taskMutex;
     std::condition_variable cv;
+    std::condition_variable retired;   // signalled when a worker leaves for setBounds()
     bool shutdown = false;
+    // Everything below is guarded by taskMutex
+    ThreadPoolBounds bounds;
+    std::size_t retiring = 0;      // workers asked to leave by setBounds()
+    std::size_t idleWorkers = 0;
+    std::chrono::nanoseconds queueWaitAvg{0};
+    std::chrono::steady_clock::time_point lastGrowth{};
+    std::mutex resizeMutex;          // serializes setBounds()
+    // Mirrors written by publish() under taskMutex, read by spinning workers and by
+    // monitoring without the lock
+    std::atomic<WaitStrategy> waitStrategy;
+    std::atomic<std::size_t> queuedHint{0};
+    std::atomic<bool> interruptHint{false};   // shutdown or retiring workers
+    std::atomic<std::size_t> workerHint{0};
+    std::atomic<std::int64_t> queueWaitHint{0};   // queueWaitAvg in nanoseconds
+    std::function<void()> workerInit;   // guarded by taskMutex
+    std::atomic<std::uint64_t> initGeneration{0};   // bumped by setWorkerInit(), written under taskMutex
 
 public:
     ThreadPool() = delete;
-    ThreadPool(std::size_t numThreads){
-        for(std::size_t i = 0 ; i < numThreads ; i++){
+    ThreadPool(std::size_t numThreads, WaitStrategy wait = WaitStrategy::BLOCK)
+        : ThreadPool(ThreadPoolBounds{numThreads, numThreads}, wait){}
+    explicit ThreadPool(const ThreadPoolBounds& limits, WaitStrategy wait = WaitStrategy::BLOCK)
+        : bounds(limits), waitStrategy(wait){
+        std::unique_lock<std::mutex> lock(taskMutex);   // workers read 'workers' as soon as they start
+        for(std::size_t i = 0 ; i < bounds.minThreads ; i++){
             workers.emplace_back([this]() {workerLoop();});  // capture this to access object scope workerLoop function
         }
+        publish();
     }
 
     ~ThreadPool (){
@@ -35,11 +83,16 @@ public:
         // Every variable used in the same cv.wait() predicate must be modified under the same mutex.
             std::unique_lock<std::mutex> lock(taskMutex);
             shutdown = true;
-        } 
+            publish();
+        }
         cv.notify_all();  // wake all threads to exit
+        // No worker joins or leaves once 'shutdown' is set
         for(auto& worker: workers){
             worker.join();
         }
+        for(auto& worker: exited){
+            worker.join();
+        }
     }
     // Non-copyable, non-movable
     ThreadPool(const ThreadPool&) = delete;
@@ -48,33 +101,235 @@ public:
     ThreadPool& operator=(ThreadPool&&) = delete;
 
     bool enqueue(std::function<void()> task) {
+        return push(tasks, std::move(task));
+    }
+
+    // High-priority lane: the next free worker takes these before any normal task,
+    // so they never wait behind a backlog of normal tasks.
+    bool enqueuePriority(std::function<void()> task) {
+        return push(priorityTasks, std::move(task));
+    }
+
+    // Pins the pool to exactly 'numThreads' workers; see setBounds()
+    bool resize(std::size_t numThreads){
+        ThreadPoolBounds limits;
+        {
+            std::unique_lock<std::mutex> lock(taskMutex);
+            limits = bounds;
+        }
+        limits.minThreads = numThreads;
+        limits.maxThreads = numThreads;
+        return setBounds(limits);
+    }
+
+    // Changes the limits while tasks keep flowing. Workers are added up to minThreads;
+    // those above maxThreads leave after their current task and are joined before this
+    // returns. Queued tasks stay for the remaining ones. False for invalid bounds or
+    // after shutdown.
+    bool setBounds(const ThreadPoolBounds& limits){
+        if (limits.minThreads == 0 || limits.maxThreads < limits.minThreads) {
+            return false;
+        }
+        std::lock_guard<std::mutex> resizeLock(resizeMutex);
+        std::vector<std::thread> finished;
         {
             std::unique_lock<std::mutex> lock(taskMutex);
             if (shutdown) {
                 return false;
             }
-            tasks.emplace(std::move(task));
+            bounds = limits;
+            while (workers.size() < bounds.minThreads) {
+                workers.emplace_back([this]() {workerLoop();});
+            }
+            retiring = workers.size() > bounds.maxThreads ? workers.size() - bounds.maxThreads : 0;
+            publish();
+            cv.notify_all();  // retiring workers may be parked in cv.wait()
+            retired.wait(lock, [this]() { return retiring == 0 || shutdown; });
+            finished.swap(exited);
+        }
+        for (auto& worker : finished) {
+            worker.join();
         }
-        cv.notify_one();
         return true;
     }
 
+    // workerCount(), pendingTasks() and queueWait() are lock-free reads of the mirrors,
+    // so monitoring never contends with enqueue() or the workers
+    std::size_t workerCount() const {
+        return workerHint.load(std::memory_order_relaxed);
+    }
+
+    // Tasks queued (both lanes) but not yet picked up by a worker
+    std::size_t pendingTasks() const {
+        return queuedHint.load(std::memory_order_relaxed);
+    }
+
+    // Runs 'init' on every worker: current ones before their next task, later ones
+    // (grown by an elastic pool) when they start. E.g. naming or pinning threads.
+    void setWorkerInit(std::function<void()> init) {
+        {
+            std::unique_lock<std::mutex> lock(taskMutex);
+            workerInit = std::move(init);
+            initGeneration.fetch_add(1, std::memory_order_relaxed);
+        }
+        cv.notify_all();
+    }
+
+    // How idle workers wait; workers already parked pick it up on their next wait
+    void setWaitStrategy(WaitStrategy strategy) noexcept {
+        waitStrategy.store(strategy, std::memory_order_relaxed);
+    }
+
+    // Smoothed time tasks spent queued before a worker picked them up
+    std::chrono::nanoseconds queueWait() const {
+        return std::chrono::nanoseconds(queueWaitHint.load(std::memory_order_relaxed));
+    }
+
 private:
+    bool push(std::queue<Task>& queue, std::function<void()> task) {
+        {
+            std::unique_lock<std::mutex> lock(taskMutex);
+            if (shutdown) {
+                return false;
+            }
+            const auto now = std::chrono::steady_clock::now();
+            queue.push(Task{std::move(task), now});
+            // Workers stuck in long tasks never dequeue, so adapt() would not run: judge by
+            // the oldest queued task here too
+            growIfLate(now, now - oldestQueuedAt());
+            publish();
+        }
+        cv.notify_one();
+        return true;
+    }
+
+    // Called with taskMutex held
+    void publish() noexcept {
+        queuedHint.store(tasks.size() + priorityTasks.size(), std::memory_order_relaxed);
+        interruptHint.store(shutdown || retiring > 0, std::memory_order_relaxed);
+        workerHint.store(workers.size(), std::memory_order_relaxed);
+        queueWaitHint.store(queueWaitAvg.count(), std::memory_order_relaxed);
+    }
+
+    // Called with taskMutex held; the calling worker must return right after
+    void leave(std::unique_lock<std::mutex>& lock){
+        const auto self = std::find_if(workers.begin(), workers.end(),
+                                       [](const std::thread& t) { return t.get_id() == std::this_thread::get_id(); });
+        std::vector<std::thread> finished;
+        finished.swap(exited);   // join earlier leavers here so 'exited' stays short
+        exited.push_back(std::move(*self));
+        workers.erase(self);
+        publish();
+        lock.unlock();
+        retired.notify_all();
+        for (auto& worker : finished) {
+            worker.join();
+        }
+    }
+
+    // Called with taskMutex held after popping a task that waited 'waited'
+    void adapt(std::chrono::steady_clock::time_point now, std::chrono::nanoseconds waited){
+        queueWaitAvg += (waited - queueWaitAvg) / WAIT_SMOOTHING;
+        // The latest sample must be late too: the average still remembers the last burst
+        if (queueWaitAvg > bounds.waitTarget) {
+            growIfLate(now, waited);
+        }
+    }
+
+    // Called with taskMutex held; adds a worker if a task has waited past waitTarget.
+    // At most one new worker per waitTarget, so a burst does not spawn a crowd at once.
+    void growIfLate(std::chrono::steady_clock::time_point now, std::chrono::nanoseconds waited){
+        if (!shutdown && waited > bounds.waitTarget && idleWorkers == 0 && retiring == 0 &&
+            workers.size() < bounds.maxThreads && now - lastGrowth >= bounds.waitTarget) {
+            workers.emplace_back([this]() {workerLoop();});
+            lastGrowth = now;
+        }
+    }
+
+    // Called with taskMutex held and at least one task queued
+    std::chrono::steady_clock::time_point oldestQueuedAt() const {
+        if (priorityTasks.empty()) {
+            return tasks.front().queuedAt;
+        }
+        if (tasks.empty()) {
+            return priorityTasks.front().queuedAt;
+        }
+        return std::min(tasks.front().queuedAt, priorityTasks.front().queuedAt);
+    }
+
     void workerLoop(){
+        std::uint64_t initApplied = 0;
+        std::unique_lock<std::mutex> lock(taskMutex);
         while(true){
-            std::unique_lock<std::mutex> lock(taskMutex);
-            cv.wait(lock , [this](){return !tasks.empty() || shutdown;});
+            auto ready = [this, &initApplied](){
+                return !priorityTasks.empty() || !tasks.empty() || shutdown || retiring > 0 ||
+                       initGeneration.load(std::memory_order_relaxed) != initApplied;
+            };
+            bool woken = true;
+            bool timedOut = false;
+            bool spun = true;
+            ++idleWorkers;
+            const WaitStrategy strategy = waitStrategy.load(std::memory_order_relaxed);
+            const bool mayRetire = workers.size() > bounds.minThreads;
+            if (strategy != WaitStrategy::BLOCK && !ready()) {
+                const auto deadline = mayRetire ? std::chrono::steady_clock::now() + bounds.idleTimeout
+                                                : std::chrono::steady_clock::time_point::max();
+                lock.unlock();
+                spun = spinWait(strategy, [this, &initApplied]() {
+                    return queuedHint.load(std::memory_order_relaxed) != 0 ||
+                           interruptHint.load(std::memory_order_relaxed) ||
+                           initGeneration.load(std::memory_order_relaxed) != initApplied;
+                }, deadline);
+                lock.lock();
+            }
+            if (strategy == WaitStrategy::SPIN) {
+                woken = ready();   // never parks; the spin deadline stands in for the idle timeout
+                timedOut = !spun;
+            } else if (mayRetire) {
+                woken = cv.wait_for(lock, bounds.idleTimeout, ready);
+                timedOut = !woken;
+            } else {
+                cv.wait(lock, ready);
+            }
+            --idleWorkers;
 
-            if (shutdown && tasks.empty()) {   // Exit if signaled to shutdown and queue is empty
+            if (!shutdown && (retiring > 0 || (timedOut && workers.size() > bounds.minThreads))) {
+                if (retiring > 0) {
+                    --retiring;   // asked to leave by setBounds(); the others take the remaining tasks
+                    publish();
+                }
+                leave(lock);
                 return;
             }
+            if (shutdown && priorityTasks.empty() && tasks.empty()) {   // Exit if signaled to shutdown and queues are empty
+                return;
+            }
+            if (initGeneration.load(std::memory_order_relaxed) != initApplied) {
+                initApplied = initGeneration.load(std::memory_order_relaxed);
+                auto init = workerInit;
+                lock.unlock();
+                if (init) {
+                    init();
+                }
+                lock.lock();
+                continue;
+            }
+            if (!woken) {
+                continue;   // idle timeout at minThreads, or another worker took the task
+            }
 
-            auto task = std::move(tasks.front());
-            tasks.pop();        
+            auto& queue = priorityTasks.empty() ? tasks : priorityTasks;
+            auto task = std::move(queue.front());
+            queue.pop();
+            const auto now = std::chrono::steady_clock::now();
+            adapt(now, now - task.queuedAt);
+            publish();
             lock.unlock();      // finished operations on shared queue allow other thread to join
-            if (task) {
-                task();         // start executing the function
+            if (task.run) {
+                LOG_TRACE_SPAN("task");
+                task.run();     // start executing the function
             }
+            lock.lock();
         }
     }
-};
\ No newline at end of file
+};
@@ -0,0 +1,82 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <thread>
+
+// How a thread waits for work (ThreadPool workers, blocking RingBuffer pops).
+// Parking costs a futex wake and a context switch per hand-off; spinning avoids both
+// while the waiter burns its core.
+enum class WaitStrategy
+{
+    BLOCK,     // park on the condition variable right away
+    ADAPTIVE,  // spin with a pause hint, then yield, then park
+    SPIN,      // spin with a pause hint until ready; parks only to honour a timeout
+};
+
+namespace wait_detail
+{
+inline constexpr std::uint32_t ADAPTIVE_SPINS = 1024;
+inline constexpr std::uint32_t ADAPTIVE_YIELDS = 64;
+inline constexpr std::uint32_t CLOCK_CHECK_MASK = 255;  // read the clock every 256 rounds
+
+inline void cpuRelax() noexcept
+{
+#if defined(__x86_64__) || defined(__i386__)
+    __builtin_ia32_pause();
+#elif defined(__aarch64__)
+    asm volatile("yield");
+#endif
+}
+
+// With one CPU the thread we wait for cannot run while we spin
+inline bool singleCpu() noexcept
+{
+    static const bool single = std::thread::hardware_concurrency() == 1;
+    return single;
+}
+} // namespace wait_detail
+
+// Spins (and yields, for ADAPTIVE) until ready() holds, without taking any lock.
+// Returns false once the ADAPTIVE budget is spent or 'deadline' passes: park then.
+// 'ready' should only read atomics; the caller re-checks under its lock.
+template <typename Ready>
+bool spinWait(WaitStrategy strategy, Ready &&ready,
+              std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::time_point::max())
+{
+    if (strategy == WaitStrategy::BLOCK)
+    {
+        return ready();
+    }
+    for (std::uint32_t round = 0;; ++round)
+    {
+        if (ready())
+        {
+            return true;
+        }
+        if ((round & wait_detail::CLOCK_CHECK_MASK) == wait_detail::CLOCK_CHECK_MASK &&
+            std::chrono::steady_clock::now() >= deadline)
+        {
+            return false;
+        }
+        if (strategy == WaitStrategy::SPIN || round < wait_detail::ADAPTIVE_SPINS)
+        {
+            if (wait_detail::singleCpu())
+            {
+                std::this_thread::yield();
+            }
+            else
+            {
+                wait_detail::cpuRelax();
+            }
+        }
+        else if (round < wait_detail::ADAPTIVE_SPINS + wait_detail::ADAPTIVE_YIELDS)
+        {
+            std::this_thread::yield();
+        }
+        else
+        {
+            return false;
+        }
+    }
+}
@@ -0,0 +1,93 @@
+#include "BinaryLogReader.hpp"
+#include <utility>
+
+namespace
+{
+std::chrono::system_clock::time_point fromNanos(std::int64_t ns)
+{
+    return std::chrono::system_clock::time_point(
+        std::chrono::duration_cast<std::chrono::system_clock::duration>(std::chrono::nanoseconds(ns)));
+}
+} // namespace
+
+bool BinaryLogQuery::mayMatch(const binlog::BlockSummary &summary) const noexcept
+{
+    return (summary.severityMask & severityMask) != 0 &&
+           (summary.sourceMask & sourceMask) != 0 &&
+           fromNanos(summary.maxTimeNs) >= from &&
+           fromNanos(summary.minTimeNs) <= to;
+}
+
+bool BinaryLogQuery::matches(const BinaryLogRecord &record) const noexcept
+{
+    return (binlog::bit(record.severity) & severityMask) != 0 &&
+           (binlog::bit(record.source) & sourceMask) != 0 &&
+           record.time >= from && record.time <= to;
+}
+
+std::expected<BinaryLogReader, BinaryLogError> BinaryLogReader::open(const std::string &path)
+{
+    MappedFile mapping;
+    if (!mapping.open(path))
+    {
+        return std::unexpected(BinaryLogError::OPEN_FAILED);
+    }
+    if (mapping.size() < sizeof(binlog::FileHeader))
+    {
+        return std::unexpected(BinaryLogError::BAD_HEADER);
+    }
+
+    BinaryLogReader reader(std::move(mapping));
+    if (!reader.loadIndex())
+    {
+        return std::unexpected(BinaryLogError::BAD_HEADER);
+    }
+    return reader;
+}
+
+bool BinaryLogReader::loadIndex()
+{
+    const char *base = mapping.data();
+    const std::size_t size = mapping.size();
+
+    binlog::FileHeader header;
+    std::memcpy(&header, base, sizeof(header));
+    if (header.magic != binlog::FILE_MAGIC || header.version != binlog::VERSION)
+    {
+        return false;
+    }
+
+    if (size >= sizeof(binlog::FileHeader) + sizeof(binlog::Footer))
+    {
+        binlog::Footer footer;
+        std::memcpy(&footer, base + size - sizeof(footer), sizeof(footer));
+        const std::size_t indexBytes = std::size_t{footer.blockCount} * sizeof(binlog::IndexEntry);
+        // Compared without adding: a corrupt indexOffset must not wrap around
+        const std::size_t indexEnd = size - sizeof(footer);
+        if (footer.magic == binlog::FOOTER_MAGIC &&
+            footer.indexOffset >= sizeof(binlog::FileHeader) && footer.indexOffset <= indexEnd &&
+            indexBytes == indexEnd - footer.indexOffset)
+        {
+            blockIndex.resize(footer.blockCount);
+            std::memcpy(blockIndex.data(), base + footer.indexOffset, indexBytes);
+            footerFound = true;
+            return true;
+        }
+    }
+
+    // No footer: the writer is still running or was killed; walk the block headers
+    std::size_t offset = sizeof(binlog::FileHeader);
+    while (offset + sizeof(binlog::BlockHeader) <= size)
+    {
+        binlog::BlockHeader block;
+        std::memcpy(&block, base + offset, sizeof(block));
+        if (block.magic != binlog::BLOCK_MAGIC ||
+            block.payloadBytes > size - offset - sizeof(block))
+        {
+            break;
+        }
+        blockIndex.push_back(binlog::IndexEntry{offset, block.summary});
+        offset += sizeof(block) + block.payloadBytes;
+    }
+    return true;
+}
@@ -0,0 +1,130 @@
+#pragma once
+
+#include "sinks/BinaryLogFormat.hpp"
+#include "utils/MappedFile.hpp"
+#include <chrono>
+#include <cstring>
+#include <expected>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+enum class BinaryLogError
+{
+    OPEN_FAILED,  // missing, unreadable or could not be mapped
+    BAD_HEADER,
+};
+
+struct BinaryLogRecord
+{
+    std::chrono::system_clock::time_point time;
+    TelemetrySrc source;
+    SeverityLvl severity;
+    std::optional<float> value;
+    std::string_view payload;  // points into the mapping, valid while the reader lives
+};
+
+// Block-level filters are checked first; records are only decoded in blocks that may match
+struct BinaryLogQuery
+{
+    std::chrono::system_clock::time_point from = std::chrono::system_clock::time_point::min();
+    std::chrono::system_clock::time_point to = std::chrono::system_clock::time_point::max();
+    std::uint32_t severityMask = binlog::ALL_BITS;
+    std::uint32_t sourceMask = binlog::ALL_BITS;
+
+    [[nodiscard]] bool mayMatch(const binlog::BlockSummary &summary) const noexcept;
+    [[nodiscard]] bool matches(const BinaryLogRecord &record) const noexcept;
+};
+
+struct BinaryLogScanStats
+{
+    std::size_t blocksTotal = 0;
+    std::size_t blocksScanned = 0;
+    std::size_t recordsMatched = 0;
+};
+
+// Read-only mmap view of a file written by BinaryFileSinkImpl.
+// Uses the footer index when present; a file whose writer never closed it is
+// indexed by walking block headers, which skips payloads and stops at a torn tail.
+class BinaryLogReader
+{
+private:
+    MappedFile mapping;
+    std::vector<binlog::IndexEntry> blockIndex;
+    bool footerFound = false;
+
+    explicit BinaryLogReader(MappedFile mapping) : mapping(std::move(mapping)) {}
+    bool loadIndex();
+
+public:
+    static std::expected<BinaryLogReader, BinaryLogError> open(const std::string &path);
+
+    [[nodiscard]] const std::vector<binlog::IndexEntry> &blocks() const noexcept { return blockIndex; }
+    [[nodiscard]] bool hasFooter() const noexcept { return footerFound; }
+
+    // Calls fn(const BinaryLogRecord&) for every matching record, in file order
+    template <typename Fn>
+    BinaryLogScanStats query(const BinaryLogQuery &query, Fn &&fn) const;
+};
+
+template <typename Fn>
+BinaryLogScanStats BinaryLogReader::query(const BinaryLogQuery &query, Fn &&fn) const
+{
+    BinaryLogScanStats stats;
+    stats.blocksTotal = blockIndex.size();
+    const char *base = mapping.data();
+    const std::size_t size = mapping.size();
+
+    for (const auto &entry : blockIndex)
+    {
+        if (!query.mayMatch(entry.summary))
+        {
+            continue;
+        }
+        if (size < sizeof(binlog::BlockHeader) || entry.offset > size - sizeof(binlog::BlockHeader))
+        {
+            continue;  // index points past the end of the file
+        }
+        ++stats.blocksScanned;
+
+        binlog::BlockHeader header;
+        std::memcpy(&header, base + entry.offset, sizeof(header));
+        if (header.magic != binlog::BLOCK_MAGIC ||
+            header.payloadBytes > size - entry.offset - sizeof(header))
+        {
+            continue;
+        }
+        const char *cursor = base + entry.offset + sizeof(header);
+        const char *end = cursor + header.payloadBytes;
+
+        while (cursor + sizeof(binlog::RecordHeader) <= end)
+        {
+            binlog::RecordHeader raw;
+            std::memcpy(&raw, cursor, sizeof(raw));
+            cursor += sizeof(raw);
+            if (raw.payloadLength > static_cast<std::size_t>(end - cursor))
+            {
+                break;  // corrupt record, skip the rest of the block
+            }
+
+            BinaryLogRecord record{
+                std::chrono::system_clock::time_point(
+                    std::chrono::duration_cast<std::chrono::system_clock::duration>(
+                        std::chrono::nanoseconds(raw.timeNs))),
+                static_cast<TelemetrySrc>(raw.source),
+                static_cast<SeverityLvl>(raw.severity),
+                (raw.flags & binlog::FLAG_HAS_VALUE) ? std::optional<float>(raw.value) : std::nullopt,
+                std::string_view(cursor, raw.payloadLength)};
+            cursor += raw.payloadLength;
+
+            if (query.matches(record))
+            {
+                ++stats.recordsMatched;
+                fn(record);
+            }
+        }
+    }
+    return stats;
+}
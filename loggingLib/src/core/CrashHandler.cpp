@@ -0,0 +1,186 @@
+#include "CrashHandler.hpp"
+#include <algorithm>
+#include <cerrno>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+std::atomic<CrashHandler *> CrashHandler::active{nullptr};
+struct sigaction CrashHandler::previous[CrashHandler::SIGNAL_COUNT]{};
+
+namespace
+{
+// One per armed thread; disarmed and unmapped when the thread exits
+struct AltStack
+{
+    void *memory = nullptr;
+    std::size_t bytes = 0;
+
+    ~AltStack()
+    {
+        if (memory)
+        {
+            stack_t disable{};
+            disable.ss_flags = SS_DISABLE;
+            ::sigaltstack(&disable, nullptr);
+            ::munmap(memory, bytes);
+        }
+    }
+};
+
+thread_local AltStack altStack;
+} // namespace
+
+CrashHandler::CrashHandler(DumpFn dump, const void *context) noexcept
+    : dump(dump), context(context)
+{
+}
+
+CrashHandler::~CrashHandler()
+{
+    uninstall();
+}
+
+bool CrashHandler::install(const std::string &dumpPath)
+{
+    if (installed)
+    {
+        return true;
+    }
+
+    // Open now: open(2) with O_CREAT is not something to attempt mid-crash
+    if (!file.open(dumpPath, O_WRONLY | O_CREAT | O_APPEND | O_CLOEXEC))
+    {
+        return false;
+    }
+
+    CrashHandler *expected = nullptr;
+    if (!active.compare_exchange_strong(expected, this))
+    {
+        file.close();
+        return false;
+    }
+
+    armThread();
+
+    struct sigaction action{};
+    action.sa_sigaction = &CrashHandler::onSignal;
+    sigemptyset(&action.sa_mask);
+    action.sa_flags = SA_SIGINFO | SA_ONSTACK;
+
+    for (std::size_t i = 0; i < SIGNAL_COUNT; ++i)
+    {
+        ::sigaction(fatalSignals[i], &action, &previous[i]);
+    }
+    installed = true;
+    return true;
+}
+
+void CrashHandler::uninstall()
+{
+    if (!installed)
+    {
+        return;
+    }
+
+    for (std::size_t i = 0; i < SIGNAL_COUNT; ++i)
+    {
+        ::sigaction(fatalSignals[i], &previous[i], nullptr);
+    }
+
+    CrashHandler *expected = this;
+    active.compare_exchange_strong(expected, nullptr);
+    file.close();
+    installed = false;
+}
+
+bool CrashHandler::isInstalled() const noexcept
+{
+    return installed;
+}
+
+void CrashHandler::writeRaw(int fd, std::string_view text) noexcept
+{
+    while (!text.empty())
+    {
+        ssize_t written = ::write(fd, text.data(), text.size());
+        if (written < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            return;
+        }
+        text.remove_prefix(static_cast<std::size_t>(written));
+    }
+}
+
+bool CrashHandler::armThread() noexcept
+{
+    if (altStack.memory)
+    {
+        return true;
+    }
+    const std::size_t bytes = std::max<std::size_t>(ALT_STACK_BYTES, SIGSTKSZ);
+    void *memory = ::mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (memory == MAP_FAILED)
+    {
+        return false;
+    }
+    stack_t stack{};
+    stack.ss_sp = memory;
+    stack.ss_size = bytes;
+    if (::sigaltstack(&stack, nullptr) != 0)
+    {
+        ::munmap(memory, bytes);
+        return false;
+    }
+    altStack.memory = memory;
+    altStack.bytes = bytes;
+    return true;
+}
+
+void CrashHandler::onSignal(int signum, siginfo_t *info, void *)
+{
+    // exchange() also keeps a second crashing thread from dumping twice
+    CrashHandler *handler = active.exchange(nullptr);
+    if (handler)
+    {
+        int savedErrno = errno;
+        int fd = handler->file.get();
+
+        // Format the signal number by hand; no snprintf in signal context
+        char digits[12];
+        std::size_t pos = sizeof(digits);
+        int value = signum;
+        do
+        {
+            digits[--pos] = static_cast<char>('0' + value % 10);
+            value /= 10;
+        } while (value > 0 && pos > 0);
+
+        writeRaw(fd, "=== fatal signal ");
+        writeRaw(fd, std::string_view(digits + pos, sizeof(digits) - pos));
+        writeRaw(fd, ": emergency dump of unwritten log messages ===\n");
+        handler->dump(fd, handler->context);
+        writeRaw(fd, "=== end of emergency dump ===\n");
+        ::fsync(fd);
+        errno = savedErrno;
+    }
+
+    // Chain: put back what was there before us. A fault re-executes the instruction on
+    // return and reaches it with the original siginfo; a signal sent by kill()/raise()/
+    // abort() is sent again and delivered to it once this handler returns.
+    for (std::size_t i = 0; i < SIGNAL_COUNT; ++i)
+    {
+        if (fatalSignals[i] == signum)
+        {
+            ::sigaction(signum, &previous[i], nullptr);
+        }
+    }
+    if (info == nullptr || info->si_code <= 0)
+    {
+        ::raise(signum);
+    }
+}
@@ -0,0 +1,54 @@
+#pragma once
+
+#include "utils/SafeFile.hpp"
+#include <atomic>
+#include <csignal>
+#include <string>
+#include <string_view>
+
+// Process-wide handler for fatal signals (SIGSEGV, SIGABRT, SIGBUS, SIGFPE, SIGILL).
+// The dump file is opened up front; on a crash the dump callback gets the raw fd and
+// must stick to async-signal-safe calls (no allocation, no locks). Afterwards the
+// handler installed before this one (or the default action) gets the signal, so other
+// crash reporters and core dumps keep working. Only one handler can be installed at a time.
+//
+// The handler runs on an alternate signal stack, so a stack overflow can still be
+// dumped. Alternate stacks are per thread: install() arms the calling thread, other
+// threads that may overflow call armThread() once.
+class CrashHandler
+{
+public:
+    using DumpFn = void (*)(int fd, const void *context) noexcept;
+
+    CrashHandler(DumpFn dump, const void *context) noexcept;
+    ~CrashHandler();
+
+    CrashHandler(const CrashHandler &) = delete;
+    CrashHandler &operator=(const CrashHandler &) = delete;
+    CrashHandler(CrashHandler &&) = delete;
+    CrashHandler &operator=(CrashHandler &&) = delete;
+
+    bool install(const std::string &dumpPath);
+    void uninstall();
+    [[nodiscard]] bool isInstalled() const noexcept;
+
+    // write(2) loop usable from the dump callback
+    static void writeRaw(int fd, std::string_view text) noexcept;
+    // Gives the calling thread an alternate signal stack, freed when the thread exits
+    static bool armThread() noexcept;
+
+private:
+    static constexpr int fatalSignals[] = {SIGSEGV, SIGABRT, SIGBUS, SIGFPE, SIGILL};
+    static constexpr std::size_t SIGNAL_COUNT = sizeof(fatalSignals) / sizeof(fatalSignals[0]);
+    static constexpr std::size_t ALT_STACK_BYTES = 64 * 1024;
+
+    SafeFile file;
+    DumpFn dump;
+    const void *context;
+    bool installed = false;
+
+    static std::atomic<CrashHandler *> active;
+    // Actions replaced by the active handler; static so a crash after the dump can still chain
+    static struct sigaction previous[SIGNAL_COUNT];
+    static void onSignal(int signum, siginfo_t *info, void *ucontext);
+};
@@ -0,0 +1,72 @@
+#pragma once
+
+#include "LogMessage.hpp"
+#include <atomic>
+#include <memory>
+
+// A routed message, shared by all of its per-sink write tasks.
+struct InFlightMessage
+{
+    LogMessage msg;
+    std::atomic<std::size_t> remaining{0};  // sink writes still queued or running
+    std::size_t chargedBytes = 0;           // released from the byte budget once written everywhere
+
+    explicit InFlightMessage(const LogMessage &m) : msg(m) {}
+};
+
+// Fixed-size ring of the most recently dispatched messages. It lets a crash handler
+// find messages that left the RingBuffer but are still queued on the ThreadPool,
+// without locking or allocating. One writer at a time (the lane's drainer);
+// once full, the oldest entries are overwritten.
+class DispatchJournal
+{
+private:
+    struct Slot
+    {
+        std::atomic<const InFlightMessage *> entry{nullptr};
+        std::shared_ptr<InFlightMessage> owner;
+    };
+
+    std::unique_ptr<Slot[]> slots;
+    std::size_t slotCount = 0;
+    std::size_t next = 0;
+
+public:
+    // Allocates the slots up front; 0 disables the journal
+    void resize(std::size_t size)
+    {
+        slots = size ? std::make_unique<Slot[]>(size) : nullptr;
+        slotCount = size;
+        next = 0;
+    }
+
+    [[nodiscard]] bool enabled() const noexcept
+    {
+        return slotCount != 0;
+    }
+
+    void record(std::shared_ptr<InFlightMessage> msg)
+    {
+        Slot &slot = slots[next];
+        // Hide the slot while its owner changes so the reader never sees a freed entry pointer
+        slot.entry.store(nullptr, std::memory_order_release);
+        slot.owner = std::move(msg);
+        slot.entry.store(slot.owner.get(), std::memory_order_release);
+        next = (next + 1) % slotCount;
+    }
+
+    // Visits, oldest first, recorded messages that some sink has not written yet.
+    // Signal-safe: no locks, no allocation.
+    template <typename Fn>
+    void forEachPending(Fn &&fn) const noexcept
+    {
+        for (std::size_t i = 0; i < slotCount; ++i)
+        {
+            const InFlightMessage *entry = slots[(next + i) % slotCount].entry.load(std::memory_order_acquire);
+            if (entry && entry->remaining.load(std::memory_order_acquire) > 0)
+            {
+                fn(entry->msg);
+            }
+        }
+    }
+};
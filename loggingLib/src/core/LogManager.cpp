@@ -1,37 +1,1083 @@
 #include "LogManager.hpp"
+#include "utils/Trace.hpp"
+#include <algorithm>
+#include <iterator>
+#include <magic_enum.hpp>
 
-void LogManager::route(const LogMessage &msg)
+namespace
 {
-    for (const auto &sink : sinks)
+// What the byte budget charges per message: the object plus its string contents
+std::size_t messageBytes(std::size_t timeStampSize, std::size_t payloadSize) noexcept
+{
+    return sizeof(LogMessage) + timeStampSize + payloadSize;
+}
+
+std::size_t messageBytes(const LogMessage &msg) noexcept
+{
+    return messageBytes(msg.getTimeStamp().size(), msg.getPayload().size());
+}
+} // namespace
+
+LogManager::LogManager(std::size_t bufferCapacity, std::size_t numThreads,
+                       std::size_t criticalCapacity, std::size_t shardCount, OverflowPolicy overflow,
+                       std::size_t byteBudget, std::size_t realtimeSlots)
+    : byteBudget(byteBudget),
+      overflowPolicy(overflow),
+      criticalBuffer(criticalCapacity),
+      threadPool(std::make_unique<ThreadPool>(numThreads))
+{
+    if (realtimeSlots > 0)
+    {
+        // Consumers write inline, so forwarded messages never need a pool task, and a
+        // full shard is drained by the forwarder itself rather than through flush()
+        shardCount = std::max<std::size_t>(shardCount, 1);
+        if (auto ring = RealtimeRing::create(realtimeSlots))
+        {
+            realtimeRing = std::make_unique<RealtimeRing>(std::move(*ring));
+        }
+    }
+    const std::size_t count = std::max<std::size_t>(shardCount, 1);
+    const OverflowPolicy ringPolicy = byteBudget != 0 ? OverflowPolicy::REJECT : overflow;
+    shards.reserve(count);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        shards.push_back(std::make_unique<Shard>(bufferCapacity, ringPolicy));
+    }
+    if (shardCount > 0)
+    {
+        for (std::size_t i = 0; i < shards.size(); ++i)
+        {
+            shards[i]->consumer = std::thread([this, i]() { consume(*shards[i], i); });
+        }
+    }
+    threadPool->setWorkerInit([this]() { initWorker(); });
+    if (realtimeRing)
+    {
+        realtimeForwarder = std::thread([this]() { forwardLoop(); });
+    }
+}
+
+LogManager::~LogManager()
+{
+    disableCrashHandler();
+    // The forwarder goes first: it empties the ring into shards whose consumers still run
+    realtimeStopping.store(true);
+    if (realtimeForwarder.joinable())
+    {
+        realtimeForwarder.join();
+    }
+    stopping.store(true);
+    for (auto &shard : shards)
+    {
+        if (shard->consumer.joinable())
+        {
+            shard->consumer.join();  // drains its buffer before returning
+        }
+    }
+}
+
+bool LogManager::SinkSlot::acquire() noexcept
+{
+    // Pairs with removeSink(): either we see 'retired', or drain() sees our increment.
+    pending.fetch_add(1);
+    if (retired.load())
+    {
+        release();
+        return false;
+    }
+    return true;
+}
+
+void LogManager::SinkSlot::release() noexcept
+{
+    if (pending.fetch_sub(1) == 1)
+    {
+        pending.notify_all();
+    }
+}
+
+void LogManager::SinkSlot::drain() const noexcept
+{
+    std::size_t inFlight = pending.load();
+    while (inFlight != 0)
+    {
+        pending.wait(inFlight);
+        inFlight = pending.load();
+    }
+}
+
+std::uint64_t LogManager::SinkSlot::nextSequence() noexcept
+{
+    return dispatched.fetch_add(1) + 1;
+}
+
+void LogManager::SinkSlot::complete(std::uint64_t sequence)
+{
+    std::vector<std::shared_ptr<FlushBarrier>> reached;
+    {
+        std::lock_guard<std::mutex> lock(progressMutex);
+        if (sequence != watermark + 1)
+        {
+            finishedAhead.push(sequence);  // an earlier write is still running
+            return;
+        }
+        watermark = sequence;
+        while (!finishedAhead.empty() && finishedAhead.top() == watermark + 1)
+        {
+            watermark = finishedAhead.top();
+            finishedAhead.pop();
+        }
+
+        auto firstPending = std::partition(waiters.begin(), waiters.end(),
+                                           [this](const auto &w) { return w.first <= watermark; });
+        for (auto it = waiters.begin(); it != firstPending; ++it)
+        {
+            reached.push_back(std::move(it->second));
+        }
+        waiters.erase(waiters.begin(), firstPending);
+    }
+
+    for (auto &barrier : reached)
+    {
+        barrier->arrive();
+    }
+}
+
+void LogManager::SinkSlot::notifyWhenWritten(std::uint64_t sequence, std::shared_ptr<FlushBarrier> barrier)
+{
+    {
+        std::lock_guard<std::mutex> lock(progressMutex);
+        if (watermark < sequence)
+        {
+            waiters.emplace_back(sequence, std::move(barrier));
+            return;
+        }
+    }
+    barrier->arrive();
+}
+
+void LogManager::SinkSlot::recordWriteLatency(std::chrono::nanoseconds latency) noexcept
+{
+    // Exponential moving average (1/8 weight); a lost update between workers is harmless
+    std::int64_t sample = latency.count();
+    std::int64_t average = writeLatencyNanos.load(std::memory_order_relaxed);
+    average = average == 0 ? sample : average + (sample - average) / 8;
+    writeLatencyNanos.store(average, std::memory_order_relaxed);
+}
+
+void LogManager::FlushBarrier::arrive()
+{
+    if (remaining.fetch_sub(1) == 1)
+    {
+        done.set_value();
+    }
+}
+
+void LogManager::route(const LogMessage &msg, bool priority)
+{
+    LOG_TRACE_SPAN("route");
+    const auto current = sinks.load(std::memory_order_acquire);
+    // One copy shared by every sink's task instead of one copy per sink. 'remaining'
+    // starts at one so the entry cannot complete while tasks are still being queued.
+    auto entry = std::make_shared<InFlightMessage>(msg);
+    entry->remaining.store(1, std::memory_order_relaxed);
+    if (byteBudget != 0 && !priority)
+    {
+        entry->chargedBytes = messageBytes(msg);
+    }
+
+    for (const auto &slot : *current)
+    {
+        if (!slot->acquire())
+        {
+            continue;  // removed after we took the snapshot
+        }
+
+        // Capture the slot by value to extend sink lifetime until the write completes
+        auto slotCopy = slot;
+        std::uint64_t sequence = slot->nextSequence();
+        entry->remaining.fetch_add(1, std::memory_order_relaxed);
+
+        auto task = [this, slotCopy, entry, sequence]() {
+            auto start = std::chrono::steady_clock::now();
+            {
+                LOG_TRACE_SPAN("sink_write");
+                slotCopy->sink->write(entry->msg);
+            }
+            slotCopy->recordWriteLatency(std::chrono::steady_clock::now() - start);
+            finishEntry(*entry);
+            slotCopy->complete(sequence);
+            slotCopy->release();
+        };
+        bool queued = priority ? threadPool->enqueuePriority(std::move(task))
+                               : threadPool->enqueue(std::move(task));
+        if (!queued)
+        {
+            // Pool is shutting down; don't leave flush barriers waiting on it
+            finishEntry(*entry);
+            slot->complete(sequence);
+            slot->release();
+        }
+    }
+    finishEntry(*entry);
+
+    auto &journal = priority ? criticalJournal : dispatchJournal;
+    if (journal.enabled())
+    {
+        journal.record(std::move(entry));
+    }
+}
+
+void LogManager::writeInline(const LogMessage &msg)
+{
+    const auto current = sinks.load(std::memory_order_acquire);
+    for (const auto &slot : *current)
+    {
+        if (!slot->acquire())
+        {
+            continue;
+        }
+        std::uint64_t sequence = slot->nextSequence();
+        auto start = std::chrono::steady_clock::now();
+        {
+            LOG_TRACE_SPAN("sink_write");
+            slot->sink->write(msg);
+        }
+        slot->recordWriteLatency(std::chrono::steady_clock::now() - start);
+        slot->complete(sequence);
+        slot->release();
+    }
+}
+
+void LogManager::drainShard(Shard &shard)
+{
+    std::vector<std::shared_ptr<FlushBarrier>> reached;
+    {
+        LOG_TRACE_SPAN("drain");
+        std::lock_guard<std::mutex> lock(shard.drainMutex);
+        // Bounded per lock hold, so flushAsync() gets in even under a constant stream
+        for (std::size_t budget = shard.buffer.capacity(); budget > 0;)
+        {
+            const std::size_t popped =
+                shard.buffer.tryPopN(std::back_inserter(shard.batch), std::min(budget, DRAIN_BATCH));
+            if (popped == 0)
+            {
+                break;
+            }
+            for (const auto &msg : shard.batch)
+            {
+                writeInline(msg);
+                if (byteBudget != 0)
+                {
+                    releaseBytes(messageBytes(msg));
+                }
+            }
+            shard.batch.clear();
+            shard.drained += popped;
+            budget -= popped;
+        }
+        reached = takeReachedWaiters(shard);
+    }
+
+    for (auto &barrier : reached)
     {
-        // Capture shared_ptr by value to extend sink lifetime
-        auto sinkCopy = sink;
-        LogMessage msgCopy = msg;
+        barrier->arrive();
+    }
+}
+
+// Caller holds shard.drainMutex
+std::vector<std::shared_ptr<LogManager::FlushBarrier>> LogManager::takeReachedWaiters(Shard &shard)
+{
+    std::vector<std::shared_ptr<FlushBarrier>> reached;
+    auto firstPending = std::partition(shard.waiters.begin(), shard.waiters.end(),
+                                       [&shard](const auto &w) { return w.first <= shard.drained; });
+    for (auto it = shard.waiters.begin(); it != firstPending; ++it)
+    {
+        reached.push_back(std::move(it->second));
+    }
+    shard.waiters.erase(shard.waiters.begin(), firstPending);
+    return reached;
+}
+
+void LogManager::consume(Shard &shard, std::size_t index)
+{
+    setThreadName(("log-shard-" + std::to_string(index)).c_str());
+    std::uint64_t tuningApplied = 0;
+    while (true)
+    {
+        applyTuning(tuningApplied);
+        const bool stop = stopping.load();
+        drainShard(shard);
+        updatePressureIfDue();
+        if (stop && shard.buffer.isEmpty())
+        {
+            return;
+        }
+        shard.buffer.waitNotEmpty(CONSUMER_WAIT);
+    }
+}
+
+void LogManager::forwardLoop()
+{
+    setThreadName("log-rt-forward");
+    std::uint64_t tuningApplied = 0;
+    while (true)
+    {
+        applyTuning(tuningApplied);
+        const bool stop = realtimeStopping.load();
+        const bool forwarded = forwardRealtime();
+        updatePressureIfDue();
+        if (!forwarded)
+        {
+            if (stop)
+            {
+                return;
+            }
+            std::this_thread::sleep_for(REALTIME_POLL);
+        }
+    }
+}
+
+// Moves everything published in the real-time ring into the normal pipeline, in order.
+// True if anything was forwarded.
+bool LogManager::forwardRealtime()
+{
+    LOG_TRACE_SPAN("forward_realtime");
+    std::lock_guard<std::mutex> lock(realtimeDrainMutex);
+    bool forwarded = false;
+    while (auto msg = realtimeRing->tryPop())
+    {
+        dispatch(std::move(*msg));
+        forwarded = true;
+    }
+    return forwarded;
+}
+
+void LogManager::initWorker()
+{
+    setThreadName("log-worker");
+    std::uint64_t applied = 0;
+    applyTuning(applied);
+}
+
+void LogManager::applyTuning(std::uint64_t &applied)
+{
+    if (tuningGeneration.load() == applied)
+    {
+        return;
+    }
+    ThreadTuning tuning;
+    {
+        std::lock_guard<std::mutex> lock(tuningMutex);
+        tuning = threadTuning;
+        applied = tuningGeneration.load();
+    }
+    applyThreadTuning(tuning);
+}
+
+// Caller holds shard.drainMutex
+void LogManager::drainToPool(Shard &shard)
+{
+    while (shard.buffer.tryPopN(std::back_inserter(shard.batch), DRAIN_BATCH) > 0)
+    {
+        for (const auto &msg : shard.batch)
+        {
+            route(msg);
+        }
+        shard.batch.clear();
+    }
+}
+
+LogManager::Shard &LogManager::shardFor(TelemetrySrc source) noexcept
+{
+    if (shards.size() == 1)
+    {
+        return *shards.front();
+    }
+    return *shards[magic_enum::enum_index(source).value_or(0) % shards.size()];
+}
+
+std::vector<std::unique_lock<std::mutex>> LogManager::lockShards()
+{
+    // Always in index order; consumers only ever hold their own shard's lock
+    std::vector<std::unique_lock<std::mutex>> locks;
+    locks.reserve(shards.size());
+    for (auto &shard : shards)
+    {
+        locks.emplace_back(shard->drainMutex);
+    }
+    return locks;
+}
+
+void LogManager::finishEntry(InFlightMessage &entry) noexcept
+{
+    if (entry.remaining.fetch_sub(1, std::memory_order_acq_rel) == 1)
+    {
+        releaseBytes(entry.chargedBytes);
+    }
+}
+
+void LogManager::releaseBytes(std::size_t bytes) noexcept
+{
+    if (bytes != 0)
+    {
+        bufferedBytes.fetch_sub(bytes, std::memory_order_relaxed);
+    }
+}
+
+// Charges 'bytes' against the budget. When it is exhausted, makes room as the overflow
+// policy says; false if the new message has to be dropped instead.
+bool LogManager::chargeBytes(Shard &shard, std::size_t bytes)
+{
+    bool flushed = false;
+    std::size_t current = bufferedBytes.load(std::memory_order_relaxed);
+    while (true)
+    {
+        if (current + bytes <= byteBudget)
+        {
+            if (bufferedBytes.compare_exchange_weak(current, current + bytes, std::memory_order_relaxed))
+            {
+                return true;
+            }
+            continue;
+        }
 
-        threadPool->enqueue([sinkCopy, msgCopy]() mutable {
-            sinkCopy->write(msgCopy);
-        });
+        if (overflowPolicy == OverflowPolicy::OVERWRITE_OLDEST)
+        {
+            if (!discardOldest(shard))
+            {
+                return false;  // what is left is already queued on the pool
+            }
+        }
+        else
+        {
+            if (flushed)
+            {
+                return false;
+            }
+            // Only frees bytes as sinks finish, but keeps the pipeline moving
+            shard.consumer.joinable() ? drainShard(shard) : flush();
+            flushed = true;
+        }
+        current = bufferedBytes.load(std::memory_order_relaxed);
     }
 }
 
+// Under the drain lock and counted as drained, so flushAsync() targets stay reachable
+bool LogManager::discardOldest(Shard &shard)
+{
+    std::optional<LogMessage> oldest;
+    std::vector<std::shared_ptr<FlushBarrier>> reached;
+    {
+        std::lock_guard<std::mutex> lock(shard.drainMutex);
+        oldest = shard.buffer.tryPop();
+        if (!oldest)
+        {
+            return false;
+        }
+        ++shard.drained;
+        reached = takeReachedWaiters(shard);
+    }
+
+    for (auto &barrier : reached)
+    {
+        barrier->arrive();
+    }
+    releaseBytes(messageBytes(*oldest));
+    counters.add(OVERWRITTEN);
+    return true;
+}
+
 void LogManager::addSink(std::shared_ptr<ILogSink> sink)
 {
-    sinks.push_back(std::move(sink));
+    if (!sink)
+    {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(sinkUpdateMutex);
+    auto updated = std::make_shared<SinkList>(*sinks.load(std::memory_order_acquire));
+    updated->push_back(std::make_shared<SinkSlot>(std::move(sink)));
+    sinks.store(std::move(updated), std::memory_order_release);
+}
+
+bool LogManager::removeSink(const std::shared_ptr<ILogSink> &sink)
+{
+    std::shared_ptr<SinkSlot> removed;
+    {
+        std::lock_guard<std::mutex> lock(sinkUpdateMutex);
+        auto updated = std::make_shared<SinkList>(*sinks.load(std::memory_order_acquire));
+        auto it = std::find_if(updated->begin(), updated->end(),
+                               [&sink](const auto &slot) { return slot->sink == sink; });
+        if (it == updated->end())
+        {
+            return false;
+        }
+        removed = *it;
+        updated->erase(it);
+        sinks.store(std::move(updated), std::memory_order_release);
+    }
+
+    // Stop new dispatches, then wait for the ones already queued
+    removed->retired.store(true);
+    removed->drain();
+    return true;
+}
+
+std::size_t LogManager::sinkCount() const
+{
+    return sinks.load(std::memory_order_acquire)->size();
+}
+
+void LogManager::countLogged(TelemetrySrc source, SeverityLvl severity, std::optional<float> value) noexcept
+{
+    counters.add(LOGGED);
+    counters.add(SEVERITY_BASE + magic_enum::enum_index(severity).value_or(0));
+    if (value)
+    {
+        auto &latest = latestValues[magic_enum::enum_index(source).value_or(0)];
+        latest.value.store(*value, std::memory_order_relaxed);
+        latest.seen.store(true, std::memory_order_release);
+    }
+}
+
+// 'args' construct the LogMessage in the slot; tryEmplace leaves them intact on failure,
+// so forwarding them a second time for the retry is safe
+template <typename... Args>
+void LogManager::enqueue(Shard &shard, std::size_t bytes, Args &&...args)
+{
+    if (byteBudget != 0 && !chargeBytes(shard, bytes))
+    {
+        counters.add(DROPPED);
+        return;
+    }
+    if (!shard.buffer.tryEmplace(std::forward<Args>(args)...))
+    {
+        if (byteBudget != 0 && overflowPolicy == OverflowPolicy::OVERWRITE_OLDEST)
+        {
+            discardOldest(shard);  // under a budget the ring rejects; make room by count too
+        }
+        else
+        {
+            // Consumer is behind: help it out under the same lock, so the order holds
+            shard.consumer.joinable() ? drainShard(shard) : flush();
+        }
+        if (!shard.buffer.tryEmplace(std::forward<Args>(args)...))
+        {
+            releaseBytes(bytes);
+            counters.add(DROPPED);
+        }
+    }
 }
 
 void LogManager::log(const LogMessage &msg)
 {
-    if (!buffer.tryPush(msg))
+    if (realtimeRing)
+    {
+        static_cast<void>(realtimeRing->tryPush(msg));  // a full ring counts the drop
+        return;
+    }
+    LOG_TRACE_SPAN("log");
+    countLogged(msg.getSource(), msg.getSeverity(), msg.getValue());
+    if (msg.getSeverity() == SeverityLvl::CRITICAL)
+    {
+        logCritical(LogMessage(msg));
+        return;
+    }
+    enqueue(shardFor(msg.getSource()), byteBudget != 0 ? messageBytes(msg) : 0, msg);
+}
+
+void LogManager::log(LogMessage &&msg)
+{
+    if (realtimeRing)
+    {
+        static_cast<void>(realtimeRing->tryPush(msg));
+        return;
+    }
+    dispatch(std::move(msg));
+}
+
+void LogManager::dispatch(LogMessage &&msg)
+{
+    LOG_TRACE_SPAN("log");
+    countLogged(msg.getSource(), msg.getSeverity(), msg.getValue());
+    if (msg.getSeverity() == SeverityLvl::CRITICAL)
+    {
+        logCritical(std::move(msg));
+        return;
+    }
+    Shard &shard = shardFor(msg.getSource());
+    const std::size_t bytes = byteBudget != 0 ? messageBytes(msg) : 0;
+    enqueue(shard, bytes, std::move(msg));
+}
+
+void LogManager::emplaceLog(TelemetrySrc source, SeverityLvl severity, std::string timeStamp, std::string payload)
+{
+    if (realtimeRing)
+    {
+        static_cast<void>(realtimeRing->tryPush(source, severity, timeStamp, payload, std::nullopt,
+                                                          std::chrono::system_clock::now()));
+        return;
+    }
+    LOG_TRACE_SPAN("log");
+    countLogged(source, severity, std::nullopt);
+    if (severity == SeverityLvl::CRITICAL)
+    {
+        logCritical(LogMessage(source, severity, std::move(timeStamp), std::move(payload)));
+        return;
+    }
+    const std::size_t bytes = byteBudget != 0 ? messageBytes(timeStamp.size(), payload.size()) : 0;
+    enqueue(shardFor(source), bytes, source, severity, std::move(timeStamp), std::move(payload));
+}
+
+void LogManager::emplaceLog(TelemetrySrc source, SeverityLvl severity, std::string timeStamp, std::string payload,
+                            float value)
+{
+    if (realtimeRing)
+    {
+        static_cast<void>(realtimeRing->tryPush(source, severity, timeStamp, payload, value,
+                                                          std::chrono::system_clock::now()));
+        return;
+    }
+    LOG_TRACE_SPAN("log");
+    countLogged(source, severity, value);
+    if (severity == SeverityLvl::CRITICAL)
+    {
+        logCritical(LogMessage(source, severity, std::move(timeStamp), std::move(payload), value));
+        return;
+    }
+    const std::size_t bytes = byteBudget != 0 ? messageBytes(timeStamp.size(), payload.size()) : 0;
+    enqueue(shardFor(source), bytes, source, severity, std::move(timeStamp), std::move(payload), value);
+}
+
+void LogManager::logView(TelemetrySrc source, SeverityLvl severity, std::string_view timeStamp,
+                         std::string_view payload, std::optional<float> value)
+{
+    if (realtimeRing)
+    {
+        static_cast<void>(realtimeRing->tryPush(source, severity, timeStamp, payload, value,
+                                                          std::chrono::system_clock::now()));
+        return;
+    }
+    if (value)
+    {
+        emplaceLog(source, severity, std::string(timeStamp), std::string(payload), *value);
+    }
+    else
+    {
+        emplaceLog(source, severity, std::string(timeStamp), std::string(payload));
+    }
+}
+
+void LogManager::logCritical(LogMessage &&msg)
+{
+    if (!criticalBuffer.tryPush(std::move(msg)))
     {
-        flush();
-        (void)buffer.tryPush(msg);
+        flushCritical();
+        if (!criticalBuffer.tryPush(std::move(msg)))
+        {
+            counters.add(DROPPED);
+        }
+    }
+    flushCritical();
+}
+
+void LogManager::flushCritical()
+{
+    LOG_TRACE_SPAN("drain_critical");
+    std::lock_guard<std::mutex> lock(criticalDrainMutex);
+    while (auto msg = criticalBuffer.tryPop())
+    {
+        route(msg.value(), true);
     }
 }
 
 void LogManager::flush()
 {
-    while (auto msg = buffer.tryPop())
+    auto start = std::chrono::steady_clock::now();
+    if (realtimeRing)
+    {
+        forwardRealtime();
+    }
+    flushCritical();
+    updatePressure();
+
+    {
+        LOG_TRACE_SPAN("drain");
+        for (auto &shard : shards)
+        {
+            if (shard->consumer.joinable())
+            {
+                continue;  // drained by its own thread
+            }
+            std::lock_guard<std::mutex> lock(shard->drainMutex);
+            drainToPool(*shard);
+        }
+    }
+
+    lastFlushNanos.store((std::chrono::steady_clock::now() - start).count(), std::memory_order_relaxed);
+}
+
+bool LogManager::resizeBuffer(std::size_t capacity)
+{
+    if (capacity == 0)
+    {
+        return false;
+    }
+    for (auto &shard : shards)
+    {
+        while (!shard->buffer.resize(capacity))
+        {
+            // More buffered than the new size holds: move messages on, then retry
+            if (shard->consumer.joinable())
+            {
+                drainShard(*shard);
+            }
+            else
+            {
+                std::lock_guard<std::mutex> lock(shard->drainMutex);
+                drainToPool(*shard);
+            }
+        }
+    }
+    return true;
+}
+
+bool LogManager::setWorkerCount(std::size_t count)
+{
+    return threadPool->resize(count);
+}
+
+bool LogManager::setWorkerBounds(const ThreadPoolBounds &bounds)
+{
+    return threadPool->setBounds(bounds);
+}
+
+void LogManager::setPoolWaitStrategy(WaitStrategy strategy)
+{
+    threadPool->setWaitStrategy(strategy);
+}
+
+void LogManager::setBufferWaitStrategy(WaitStrategy strategy)
+{
+    for (auto &shard : shards)
+    {
+        shard->buffer.setWaitStrategy(strategy);
+    }
+}
+
+void LogManager::setThreadTuning(const ThreadTuning &tuning)
+{
+    {
+        std::lock_guard<std::mutex> lock(tuningMutex);
+        threadTuning = tuning;
+        tuningGeneration.fetch_add(1);
+    }
+    // Re-arms the worker init, so every worker runs it again before its next task
+    threadPool->setWorkerInit([this]() { initWorker(); });
+}
+
+LogManagerStats LogManager::stats() const
+{
+    LogManagerStats snapshot;
+    for (const auto &shard : shards)
     {
-        route(msg.value());
+        snapshot.bufferDepth += shard->buffer.count();
+        snapshot.bufferCapacity += shard->buffer.capacity();
+        snapshot.overwritten += shard->buffer.overwritten();
     }
-}
\ No newline at end of file
+    snapshot.criticalDepth = criticalBuffer.count();
+    snapshot.poolBacklog = threadPool->pendingTasks();
+    snapshot.workerCount = threadPool->workerCount();
+    snapshot.poolQueueWait = threadPool->queueWait();
+    const auto totals = counters.snapshot();
+    snapshot.logged = totals[LOGGED];
+    snapshot.dropped = totals[DROPPED];
+    snapshot.overwritten += totals[OVERWRITTEN];
+    snapshot.bufferedBytes = bufferedBytes.load(std::memory_order_relaxed);
+    snapshot.byteBudget = byteBudget;
+    if (realtimeRing)
+    {
+        // Ring drops never reach the counters: producers on this path must not touch them
+        const std::uint64_t realtimeDropped = realtimeRing->dropped();
+        snapshot.logged += realtimeDropped;
+        snapshot.dropped += realtimeDropped;
+        snapshot.realtimeDepth = realtimeRing->size();
+        snapshot.realtimeCapacity = realtimeRing->capacity();
+    }
+    for (std::size_t i = 0; i < snapshot.severityCounts.size(); ++i)
+    {
+        snapshot.severityCounts[i] = totals[SEVERITY_BASE + i];
+    }
+    snapshot.lastFlushDuration = std::chrono::nanoseconds(lastFlushNanos.load(std::memory_order_relaxed));
+
+    const auto current = sinks.load(std::memory_order_acquire);
+    snapshot.sinkWriteLatency.reserve(current->size());
+    for (const auto &slot : *current)
+    {
+        snapshot.sinkWriteLatency.emplace_back(slot->writeLatencyNanos.load(std::memory_order_relaxed));
+    }
+
+    for (auto source : magic_enum::enum_values<TelemetrySrc>())
+    {
+        const auto &latest = latestValues[magic_enum::enum_index(source).value_or(0)];
+        if (latest.seen.load(std::memory_order_acquire))
+        {
+            snapshot.latestValues.emplace_back(source, latest.value.load(std::memory_order_relaxed));
+        }
+    }
+    snapshot.pressure = pressure();
+    return snapshot;
+}
+
+LogPressure LogManager::pressure() const
+{
+    return LogPressure{pressureFill.load(std::memory_order_relaxed),
+                       pressureTrend.load(std::memory_order_relaxed),
+                       pressureLevel.load(std::memory_order_relaxed)};
+}
+
+std::size_t LogManager::subscribePressure(PressureCallback callback)
+{
+    std::lock_guard<std::mutex> lock(pressureMutex);
+    const std::size_t id = nextPressureSubscriber++;
+    pressureSubscribers.emplace_back(id, std::move(callback));
+    return id;
+}
+
+void LogManager::unsubscribePressure(std::size_t id)
+{
+    std::lock_guard<std::mutex> lock(pressureMutex);
+    std::erase_if(pressureSubscribers, [id](const auto &entry) { return entry.first == id; });
+}
+
+void LogManager::updatePressure()
+{
+    // Pool backlog is measured in buffers' worth of writes, so slow sinks count too.
+    // With shards, the fullest one decides: its sources are the ones about to drop.
+    const std::size_t capacity = std::max<std::size_t>(shards.front()->buffer.capacity(), 1);
+    const std::size_t sinkTotal = std::max<std::size_t>(sinks.load(std::memory_order_acquire)->size(), 1);
+    float bufferFill = 0.0f;
+    for (const auto &shard : shards)
+    {
+        bufferFill = std::max(bufferFill, static_cast<float>(shard->buffer.count()) / static_cast<float>(capacity));
+    }
+    const float backlogFill = static_cast<float>(threadPool->pendingTasks()) / static_cast<float>(capacity * sinkTotal);
+    float fill = std::max(bufferFill, backlogFill);
+    if (byteBudget != 0)
+    {
+        fill = std::max(fill, static_cast<float>(bufferedBytes.load(std::memory_order_relaxed)) /
+                                  static_cast<float>(byteBudget));
+    }
+    if (realtimeRing)
+    {
+        fill = std::max(fill, static_cast<float>(realtimeRing->size()) / static_cast<float>(realtimeRing->capacity()));
+    }
+    fill = std::min(fill, 1.0f);
+
+    LogPressure current;
+    std::vector<PressureCallback> notify;
+    {
+        std::lock_guard<std::mutex> lock(pressureMutex);
+        const auto now = std::chrono::steady_clock::now();
+        float trend = pressureTrend.load(std::memory_order_relaxed);
+        if (lastPressureUpdate != std::chrono::steady_clock::time_point{})
+        {
+            // Floor dt so back-to-back flushes don't turn noise into a huge rate
+            const float seconds = std::max(std::chrono::duration<float>(now - lastPressureUpdate).count(), 0.001f);
+            const float rate = (fill - pressureFill.load(std::memory_order_relaxed)) / seconds;
+            trend += PRESSURE_TREND_ALPHA * (rate - trend);
+        }
+        lastPressureUpdate = now;
+
+        const float projected = std::min(fill + std::max(trend, 0.0f), 1.0f);
+        const PressureLevel previous = pressureLevel.load(std::memory_order_relaxed);
+        PressureLevel level = projected >= PRESSURE_HIGH       ? PressureLevel::HIGH
+                              : projected >= PRESSURE_ELEVATED ? PressureLevel::ELEVATED
+                                                               : PressureLevel::NORMAL;
+        if (level < previous)
+        {
+            const float crossed = previous == PressureLevel::HIGH ? PRESSURE_HIGH : PRESSURE_ELEVATED;
+            if (projected > crossed - PRESSURE_HYSTERESIS)
+            {
+                level = previous;
+            }
+        }
+
+        pressureFill.store(fill, std::memory_order_relaxed);
+        pressureTrend.store(trend, std::memory_order_relaxed);
+        pressureLevel.store(level, std::memory_order_relaxed);
+        current = LogPressure{fill, trend, level};
+
+        if (level != previous)
+        {
+            for (const auto &[id, callback] : pressureSubscribers)
+            {
+                notify.push_back(callback);
+            }
+        }
+    }
+
+    // Outside the lock so callbacks may subscribe/unsubscribe or read pressure()
+    for (const auto &callback : notify)
+    {
+        callback(current);
+    }
+}
+
+// For threads that run whether or not anyone flushes; one caller per interval wins
+void LogManager::updatePressureIfDue()
+{
+    const std::int64_t now = std::chrono::steady_clock::now().time_since_epoch().count();
+    std::int64_t due = nextPressureUpdate.load(std::memory_order_relaxed);
+    if (now < due)
+    {
+        return;
+    }
+    const auto interval = std::chrono::duration_cast<std::chrono::steady_clock::duration>(PRESSURE_INTERVAL);
+    if (nextPressureUpdate.compare_exchange_strong(due, now + interval.count(), std::memory_order_relaxed))
+    {
+        updatePressure();
+    }
+}
+
+std::future<void> LogManager::flushAsync()
+{
+    std::shared_ptr<FlushBarrier> barrier;
+    std::future<void> done;
+    if (realtimeRing)
+    {
+        forwardRealtime();  // so the barrier below covers what producers logged so far
+    }
+    updatePressure();
+
+    {
+        LOG_TRACE_SPAN("drain");
+        std::lock_guard<std::mutex> criticalLock(criticalDrainMutex);
+        auto shardLocks = lockShards();
+
+        const auto current = sinks.load(std::memory_order_acquire);
+        // One party per sink and per shard; the extra one keeps the barrier open until
+        // every party is registered
+        barrier = std::make_shared<FlushBarrier>(current->size() + shards.size() + 1);
+        done = barrier->done.get_future();
+
+        while (auto msg = criticalBuffer.tryPop())
+        {
+            route(msg.value(), true);
+        }
+        for (auto &shard : shards)
+        {
+            if (!shard->consumer.joinable())
+            {
+                drainToPool(*shard);
+                barrier->arrive();
+                continue;
+            }
+            // The consumer is parked outside its lock, so everything logged so far is
+            // either written or still in the buffer
+            const std::uint64_t target = shard->drained + shard->buffer.count();
+            if (target == shard->drained)
+            {
+                barrier->arrive();
+            }
+            else
+            {
+                shard->waiters.emplace_back(target, barrier);
+            }
+        }
+
+        // Everything logged before this call now has a sequence number on each sink
+        for (const auto &slot : *current)
+        {
+            slot->notifyWhenWritten(slot->dispatched.load(), barrier);
+        }
+    }
+
+    barrier->arrive();
+    return done;
+}
+
+bool LogManager::flushAndWait(std::chrono::steady_clock::time_point deadline)
+{
+    return flushAsync().wait_until(deadline) == std::future_status::ready;
+}
+
+bool LogManager::enableCrashHandler(const std::string &dumpPath, std::size_t journalSize)
+{
+    if (crashHandler && crashHandler->isInstalled())
+    {
+        return true;
+    }
+
+    {
+        // Journals must exist before the handler can observe them
+        std::lock_guard<std::mutex> criticalLock(criticalDrainMutex);
+        auto shardLocks = lockShards();
+        dispatchJournal.resize(journalSize);
+        criticalJournal.resize(journalSize);
+    }
+
+    crashHandler = std::make_unique<CrashHandler>(
+        [](int fd, const void *context) noexcept {
+            static_cast<const LogManager *>(context)->emergencyDump(fd);
+        },
+        this);
+
+    if (!crashHandler->install(dumpPath))
+    {
+        disableCrashHandler();
+        return false;
+    }
+    return true;
+}
+
+void LogManager::disableCrashHandler()
+{
+    if (!crashHandler)
+    {
+        return;
+    }
+    crashHandler.reset();  // uninstalls before the journals go away
+
+    std::lock_guard<std::mutex> criticalLock(criticalDrainMutex);
+    auto shardLocks = lockShards();
+    dispatchJournal.resize(0);
+    criticalJournal.resize(0);
+}
+
+// Runs inside a signal handler: only write(2), no locks, no allocation
+void LogManager::emergencyDump(int fd) const noexcept
+{
+    auto writeRecord = [fd](TelemetrySrc source, SeverityLvl severity, std::string_view timeStamp,
+                            std::string_view payload) noexcept {
+        CrashHandler::writeRaw(fd, "[");
+        CrashHandler::writeRaw(fd, magic_enum::enum_name(source));
+        CrashHandler::writeRaw(fd, "] [");
+        CrashHandler::writeRaw(fd, magic_enum::enum_name(severity));
+        CrashHandler::writeRaw(fd, "] [");
+        CrashHandler::writeRaw(fd, timeStamp);
+        CrashHandler::writeRaw(fd, "] ");
+        CrashHandler::writeRaw(fd, payload);
+        CrashHandler::writeRaw(fd, "\n");
+    };
+    auto writeMessage = [&writeRecord](const LogMessage &msg) noexcept {
+        writeRecord(msg.getSource(), msg.getSeverity(), msg.getTimeStamp(), msg.getPayload());
+    };
+
+    // Oldest first: queued on the pool, then still buffered
+    CrashHandler::writeRaw(fd, "--- dispatched, not yet written ---\n");
+    criticalJournal.forEachPending(writeMessage);
+    dispatchJournal.forEachPending(writeMessage);
+    CrashHandler::writeRaw(fd, "--- buffered ---\n");
+    criticalBuffer.forEachUnlocked(writeMessage);
+    for (const auto &shard : shards)
+    {
+        shard->buffer.forEachUnlocked(writeMessage);
+    }
+    if (realtimeRing)
+    {
+        CrashHandler::writeRaw(fd, "--- real-time ring, not yet forwarded ---\n");
+        realtimeRing->forEachUnlocked(writeRecord);
+    }
+}
@@ -1,6 +1,9 @@
 #include "LogManagerBuilder.hpp"
 #include "sinks/ConsoleSinkImpl.hpp"
 #include "sinks/FileSinkImpl.hpp"
+#include <algorithm>
+#include <bit>
+#include <sched.h>
 #include <stdexcept>
 
 LogManagerBuilder &LogManagerBuilder::withConsoleSink()
@@ -67,6 +70,116 @@ LogManagerBuilder &LogManagerBuilder::withthreadPoolSize(std::size_t size)
     return *this;
 }
 
+LogManagerBuilder &LogManagerBuilder::withElasticThreadPool(std::size_t minThreads, std::size_t maxThreads,
+                                                              std::chrono::microseconds waitTarget,
+                                                              std::chrono::milliseconds idleTimeout)
+{
+    if (minThreads == 0 || maxThreads < minThreads)
+    {
+        errors.push_back(BuilderError::INVALID_THREADPOOL_SIZE);
+        return *this;
+    }
+    poolBounds = ThreadPoolBounds{minThreads, maxThreads, waitTarget, idleTimeout};
+    return *this;
+}
+
+LogManagerBuilder &LogManagerBuilder::withCriticalBufferSize(std::size_t size)
+{
+    if (size == 0)
+    {
+        errors.push_back(BuilderError::INVALID_CRITICAL_BUFFER_SIZE);
+        return *this;
+    }
+    criticalBufferSize = size;
+    return *this;
+}
+
+LogManagerBuilder &LogManagerBuilder::withPoolWaitStrategy(WaitStrategy strategy)
+{
+    poolWait = strategy;
+    return *this;
+}
+
+LogManagerBuilder &LogManagerBuilder::withBufferWaitStrategy(WaitStrategy strategy)
+{
+    bufferWait = strategy;
+    return *this;
+}
+
+LogManagerBuilder &LogManagerBuilder::withCpuAffinity(std::vector<int> cpus)
+{
+    const bool valid = !cpus.empty() && std::ranges::all_of(cpus, [](int cpu) { return cpu >= 0 && cpu < CPU_SETSIZE; });
+    if (!valid)
+    {
+        errors.push_back(BuilderError::INVALID_CPU_SET);
+        return *this;
+    }
+    threadTuning.cpus = std::move(cpus);
+    return *this;
+}
+
+LogManagerBuilder &LogManagerBuilder::withIdleScheduling()
+{
+    threadTuning.idleScheduling = true;
+    return *this;
+}
+
+LogManagerBuilder &LogManagerBuilder::withNice(int nice)
+{
+    if (nice < -20 || nice > 19)
+    {
+        errors.push_back(BuilderError::INVALID_NICE);
+        return *this;
+    }
+    threadTuning.nice = nice;
+    return *this;
+}
+
+LogManagerBuilder &LogManagerBuilder::withIdleIoPriority()
+{
+    threadTuning.idleIo = true;
+    return *this;
+}
+
+LogManagerBuilder &LogManagerBuilder::withShards(std::size_t count)
+{
+    if (count == 0)
+    {
+        errors.push_back(BuilderError::INVALID_SHARD_COUNT);
+        return *this;
+    }
+    shardCount = count;
+    return *this;
+}
+
+LogManagerBuilder &LogManagerBuilder::withOverflowPolicy(OverflowPolicy policy)
+{
+    overflowPolicy = policy;
+    return *this;
+}
+
+LogManagerBuilder &LogManagerBuilder::withByteBudget(std::size_t bytes)
+{
+    if (bytes == 0)
+    {
+        errors.push_back(BuilderError::INVALID_BYTE_BUDGET);
+        return *this;
+    }
+    byteBudget = bytes;
+    return *this;
+}
+
+LogManagerBuilder &LogManagerBuilder::withRealtimeProfile(std::size_t slots)
+{
+    if (slots < 2 || !std::has_single_bit(slots))
+    {
+        errors.push_back(BuilderError::INVALID_REALTIME_SLOTS);
+        return *this;
+    }
+    realtimeSlots = slots;
+    return *this;
+}
+
 std::unique_ptr<LogManager> LogManagerBuilder::build()
 {
     auto result = tryBuild();
@@ -89,7 +202,22 @@ std::expected<std::unique_ptr<LogManager>, BuilderError> LogManagerBuilder::tryB
         return std::unexpected(BuilderError::NO_SINKS_CONFIGURED);
     }
 
-    auto manager = std::make_unique<LogManager>(bufferSize, threadPoolSize);
+    const std::size_t initialThreads = poolBounds ? poolBounds->minThreads : threadPoolSize;
+    auto manager = std::make_unique<LogManager>(bufferSize, initialThreads, criticalBufferSize, shardCount, overflowPolicy, byteBudget, realtimeSlots);
+    if (realtimeSlots > 0 && !manager->isRealtime())
+    {
+        return std::unexpected(BuilderError::REALTIME_SETUP_FAILED);
+    }
+    if (poolBounds)
+    {
+        manager->setWorkerBounds(*poolBounds);
+    }
+    manager->setPoolWaitStrategy(poolWait);
+    manager->setBufferWaitStrategy(bufferWait);
+    if (!threadTuning.empty())
+    {
+        manager->setThreadTuning(threadTuning);
+    }
 
     for (auto &sink : sinks)
     {
@@ -103,6 +231,15 @@ LogManagerBuilder &LogManagerBuilder::reset()
 {
     sinks.clear();
     bufferSize = 100;
+    criticalBufferSize = 16;
+    shardCount = 0;
+    overflowPolicy = OverflowPolicy::REJECT;
+    byteBudget = 0;
+    realtimeSlots = 0;
+    poolBounds.reset();
+    poolWait = WaitStrategy::BLOCK;
+    bufferWait = WaitStrategy::BLOCK;
+    threadTuning = ThreadTuning{};
     errors.clear();
     return *this;
 }
\ No newline at end of file
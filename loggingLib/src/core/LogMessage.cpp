@@ -10,6 +10,30 @@ LogMessage::LogMessage(TelemetrySrc source,
       timeStamp(std::move(timeStamp)),
       payload(std::move(payload)) {}
 
+LogMessage::LogMessage(TelemetrySrc source,
+                       SeverityLvl severity,
+                       std::string timeStamp,
+                       std::string payload,
+                       float value)
+    : source(source),
+      severity(severity),
+      timeStamp(std::move(timeStamp)),
+      payload(std::move(payload)),
+      value(value) {}
+
+LogMessage::LogMessage(TelemetrySrc source,
+                       SeverityLvl severity,
+                       std::string timeStamp,
+                       std::string payload,
+                       std::optional<float> value,
+                       std::chrono::system_clock::time_point time)
+    : source(source),
+      severity(severity),
+      timeStamp(std::move(timeStamp)),
+      payload(std::move(payload)),
+      value(value),
+      time(time) {}
+
 std::ostream &operator<<(std::ostream &os, const LogMessage &msg)
 {
     os << "[" << magic_enum::enum_name(msg.source) << "] "
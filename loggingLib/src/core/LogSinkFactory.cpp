@@ -1,6 +1,8 @@
 #include "LogSinkFactory.hpp"
 #include "sinks/FileSinkImpl.hpp"
 #include "sinks/ConsoleSinkImpl.hpp"
+#include "sinks/BinaryFileSinkImpl.hpp"
+#include "sinks/TimeSeriesSinkImpl.hpp"
 
 std::expected<std::shared_ptr<ILogSink>, SinkCreationError> LogSinkFactory::create(LogSinkType type, const std::string &config)
 {
@@ -16,6 +18,20 @@ std::expected<std::shared_ptr<ILogSink>, SinkCreationError> LogSinkFactory::crea
         }
         return std::make_shared<FileSinkImpl>(config);
 
+    case LogSinkType::BINARY:
+        if (config.empty())
+        {
+            return std::unexpected(SinkCreationError::MISSING_FILEPATH);
+        }
+        return std::make_shared<BinaryFileSinkImpl>(config);
+
+    case LogSinkType::TIMESERIES:
+        if (config.empty())
+        {
+            return std::unexpected(SinkCreationError::MISSING_FILEPATH);
+        }
+        return std::make_shared<TimeSeriesSinkImpl>(config);
+
     default:
         return std::unexpected(SinkCreationError::UNKNOWN_SINK_TYPE);
     }
@@ -0,0 +1,155 @@
+#include "MetricsServer.hpp"
+#include "utils/ThreadTuning.hpp"
+#include <magic_enum.hpp>
+#include <sstream>
+#include <unistd.h>
+
+MetricsServer::MetricsServer(const LogManager &manager, std::string socketPath)
+    : manager(manager), socketPath(std::move(socketPath))
+{
+}
+
+MetricsServer::~MetricsServer()
+{
+    stop();
+}
+
+bool MetricsServer::start()
+{
+    if (running)
+    {
+        return true;
+    }
+
+    ::unlink(socketPath.c_str());
+    if (!listener.create(SOCK_STREAM | SOCK_CLOEXEC) || !listener.bind(socketPath) || !listener.listen())
+    {
+        listener.close();
+        return false;
+    }
+
+    running = true;
+    acceptThread = std::thread([this]() {
+        setThreadName("log-metrics");
+        acceptLoop();
+    });
+    return true;
+}
+
+void MetricsServer::stop()
+{
+    if (!running.exchange(false))
+    {
+        return;
+    }
+    if (acceptThread.joinable())
+    {
+        acceptThread.join();
+    }
+    listener.close();
+    ::unlink(socketPath.c_str());
+}
+
+bool MetricsServer::isRunning() const noexcept
+{
+    return running;
+}
+
+void MetricsServer::acceptLoop()
+{
+    while (running)
+    {
+        if (!listener.waitReadable(POLL_INTERVAL_MS))
+        {
+            continue;
+        }
+
+        SafeSocket client;
+        if (listener.accept(client))
+        {
+            (void)client.writeString(renderSnapshot());
+        }
+    }
+}
+
+std::string MetricsServer::renderSnapshot() const
+{
+    const LogManagerStats stats = manager.stats();
+    std::ostringstream out;
+
+    out << "# HELP logging_messages_total Messages passed to LogManager::log(), by severity.\n"
+        << "# TYPE logging_messages_total counter\n";
+    for (auto severity : magic_enum::enum_values<SeverityLvl>())
+    {
+        out << "logging_messages_total{severity=\"" << magic_enum::enum_name(severity) << "\"} "
+            << stats.severityCounts[magic_enum::enum_index(severity).value_or(0)] << '\n';
+    }
+
+    out << "# HELP logging_messages_dropped_total Messages dropped because the buffer stayed full.\n"
+        << "# TYPE logging_messages_dropped_total counter\n"
+        << "logging_messages_dropped_total " << stats.dropped << '\n'
+        << "# HELP logging_messages_overwritten_total Buffered messages discarded to make room (overwrite-oldest mode).\n"
+        << "# TYPE logging_messages_overwritten_total counter\n"
+        << "logging_messages_overwritten_total " << stats.overwritten << '\n';
+
+    out << "# HELP logging_buffer_depth Messages waiting in the ring buffer.\n"
+        << "# TYPE logging_buffer_depth gauge\n"
+        << "logging_buffer_depth{lane=\"normal\"} " << stats.bufferDepth << '\n'
+        << "logging_buffer_depth{lane=\"critical\"} " << stats.criticalDepth << '\n';
+
+    out << "# HELP logging_buffer_capacity Capacity of the main ring buffer.\n"
+        << "# TYPE logging_buffer_capacity gauge\n"
+        << "logging_buffer_capacity " << stats.bufferCapacity << '\n';
+
+    if (stats.byteBudget != 0)
+    {
+        out << "# HELP logging_buffered_bytes Bytes held by buffered and pool-queued messages.\n"
+            << "# TYPE logging_buffered_bytes gauge\n"
+            << "logging_buffered_bytes " << stats.bufferedBytes << '\n'
+            << "# HELP logging_byte_budget Configured cap on logging_buffered_bytes.\n"
+            << "# TYPE logging_byte_budget gauge\n"
+            << "logging_byte_budget " << stats.byteBudget << '\n';
+    }
+
+    out << "# HELP logging_pool_backlog Write tasks queued on the thread pool.\n"
+        << "# TYPE logging_pool_backlog gauge\n"
+        << "logging_pool_backlog " << stats.poolBacklog << '\n';
+
+    out << "# HELP logging_pool_workers Worker threads in the thread pool.\n"
+        << "# TYPE logging_pool_workers gauge\n"
+        << "logging_pool_workers " << stats.workerCount << '\n';
+
+    out << "# HELP logging_pool_queue_wait_seconds Smoothed time a write waits for a pool worker.\n"
+        << "# TYPE logging_pool_queue_wait_seconds gauge\n"
+        << "logging_pool_queue_wait_seconds " << std::chrono::duration<double>(stats.poolQueueWait).count() << '\n';
+
+    out << "# HELP logging_pressure_fill Backpressure fill ratio (buffer or pool backlog).\n"
+        << "# TYPE logging_pressure_fill gauge\n"
+        << "logging_pressure_fill " << stats.pressure.fill << '\n'
+        << "# HELP logging_pressure_level Backpressure level: 0 normal, 1 elevated, 2 high.\n"
+        << "# TYPE logging_pressure_level gauge\n"
+        << "logging_pressure_level " << static_cast<int>(stats.pressure.level) << '\n';
+
+    out << "# HELP logging_last_flush_seconds Duration of the most recent flush().\n"
+        << "# TYPE logging_last_flush_seconds gauge\n"
+        << "logging_last_flush_seconds "
+        << std::chrono::duration<double>(stats.lastFlushDuration).count() << '\n';
+
+    out << "# HELP logging_sink_write_seconds Moving average of sink write time.\n"
+        << "# TYPE logging_sink_write_seconds gauge\n";
+    for (std::size_t i = 0; i < stats.sinkWriteLatency.size(); ++i)
+    {
+        out << "logging_sink_write_seconds{sink=\"" << i << "\"} "
+            << std::chrono::duration<double>(stats.sinkWriteLatency[i]).count() << '\n';
+    }
+
+    out << "# HELP logging_telemetry_value Latest sample logged per telemetry source.\n"
+        << "# TYPE logging_telemetry_value gauge\n";
+    for (const auto &[source, value] : stats.latestValues)
+    {
+        out << "logging_telemetry_value{source=\"" << magic_enum::enum_name(source) << "\"} "
+            << value << '\n';
+    }
+
+    return out.str();
+}
@@ -0,0 +1,43 @@
+#pragma once
+
+#include "LogManager.hpp"
+#include "utils/SafeSocket.hpp"
+#include <atomic>
+#include <string>
+#include <thread>
+
+// Serves a Prometheus text-format snapshot of a LogManager on a local Unix socket.
+// Every connection gets one snapshot, then the server closes it:
+//   socat - UNIX-CONNECT:/tmp/logging.metrics
+// Snapshots come from LogManager::stats(), which sums per-thread counters on
+// read, so scraping never contends with threads that are logging.
+class MetricsServer
+{
+private:
+    static constexpr int POLL_INTERVAL_MS = 200;  // how quickly stop() is noticed
+
+    const LogManager &manager;
+    std::string socketPath;
+    SafeSocket listener;
+    std::thread acceptThread;
+    std::atomic<bool> running{false};
+
+    void acceptLoop();
+
+public:
+    MetricsServer(const LogManager &manager, std::string socketPath);
+    ~MetricsServer();
+
+    // Non-copyable, non-movable (owns a thread referencing this)
+    MetricsServer(const MetricsServer &) = delete;
+    MetricsServer(MetricsServer &&) = delete;
+    MetricsServer &operator=(const MetricsServer &) = delete;
+    MetricsServer &operator=(MetricsServer &&) = delete;
+
+    // Replaces a stale socket file at socketPath, if any
+    bool start();
+    void stop();
+    [[nodiscard]] bool isRunning() const noexcept;
+
+    [[nodiscard]] std::string renderSnapshot() const;
+};
@@ -0,0 +1,85 @@
+#include "ShmLogCollector.hpp"
+#include "utils/ThreadTuning.hpp"
+
+ShmLogCollector::ShmLogCollector(LogManager &manager, std::string name, std::size_t capacity)
+    : manager(manager), name(std::move(name)), capacity(capacity)
+{
+}
+
+ShmLogCollector::~ShmLogCollector()
+{
+    stop();
+}
+
+std::expected<void, ShmRingError> ShmLogCollector::start()
+{
+    if (running)
+    {
+        return {};
+    }
+
+    auto created = ShmRing::create(name, capacity);
+    if (!created)
+    {
+        return std::unexpected(created.error());
+    }
+    ring.emplace(std::move(*created));
+
+    running = true;
+    drainThread = std::thread([this]() {
+        setThreadName("log-shm-drain");
+        drainLoop();
+    });
+    return {};
+}
+
+void ShmLogCollector::stop()
+{
+    if (!running.exchange(false))
+    {
+        return;
+    }
+    ring->wakeCollector();
+    if (drainThread.joinable())
+    {
+        drainThread.join();
+    }
+    if (drainAvailable())
+    {
+        manager.flush();
+    }
+}
+
+bool ShmLogCollector::isRunning() const noexcept
+{
+    return running;
+}
+
+std::uint64_t ShmLogCollector::dropped() const noexcept
+{
+    return ring ? ring->dropped() : 0;
+}
+
+bool ShmLogCollector::drainAvailable()
+{
+    bool any = false;
+    while (auto msg = ring->tryPop())
+    {
+        manager.log(std::move(*msg));
+        any = true;
+    }
+    return any;
+}
+
+void ShmLogCollector::drainLoop()
+{
+    while (running)
+    {
+        // Push each batch on to the sinks: the manager may not be flushed by anyone else
+        if (drainAvailable())
+        {
+            manager.flush();
+        }
+        ring->waitForData(WAIT_TIMEOUT);
+    }
+}
@@ -0,0 +1,50 @@
+#pragma once
+
+#include "LogManager.hpp"
+#include "concurrency/ShmRing.hpp"
+#include <atomic>
+#include <chrono>
+#include <optional>
+#include <string>
+#include <thread>
+
+// Owns the shared-memory ring that ShmLogProducers in other processes write to, and
+// feeds every record into a LogManager so one process does all the sink I/O. Each
+// drained batch is followed by a flush(), so records reach the sinks in any mode.
+// The ring survives collector restarts (records queued meanwhile are kept); remove
+// it with ShmRing::unlink() once no producer needs it.
+class ShmLogCollector
+{
+private:
+    static constexpr std::chrono::milliseconds WAIT_TIMEOUT{100};  // how quickly stop() and dead producers are noticed
+
+    LogManager &manager;
+    std::string name;
+    std::size_t capacity;
+    std::optional<ShmRing> ring;
+    std::thread drainThread;
+    std::atomic<bool> running{false};
+
+    void drainLoop();
+    bool drainAvailable();  // true if any record was taken
+
+public:
+    static constexpr std::size_t DEFAULT_CAPACITY = 4096;  // slots, power of two
+
+    ShmLogCollector(LogManager &manager, std::string name, std::size_t capacity = DEFAULT_CAPACITY);
+    ~ShmLogCollector();
+
+    // Non-copyable, non-movable (owns a thread referencing this)
+    ShmLogCollector(const ShmLogCollector &) = delete;
+    ShmLogCollector(ShmLogCollector &&) = delete;
+    ShmLogCollector &operator=(const ShmLogCollector &) = delete;
+    ShmLogCollector &operator=(ShmLogCollector &&) = delete;
+
+    std::expected<void, ShmRingError> start();
+    // Drains and flushes what is already in the ring, then stops; producers may keep writing
+    void stop();
+    [[nodiscard]] bool isRunning() const noexcept;
+
+    // Records producers dropped because the ring was full
+    [[nodiscard]] std::uint64_t dropped() const noexcept;
+};
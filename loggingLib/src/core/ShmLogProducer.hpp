@@ -0,0 +1,35 @@
+#pragma once
+
+#include "concurrency/ShmRing.hpp"
+#include <expected>
+#include <string>
+#include <utility>
+
+// Producer end of a ShmLogCollector: hands messages to the collector process through
+// shared memory instead of running a LogManager, pool and sinks in every process.
+// log() never blocks and makes no syscalls unless the collector is asleep.
+class ShmLogProducer
+{
+private:
+    ShmRing ring;
+
+    explicit ShmLogProducer(ShmRing ring) : ring(std::move(ring)) {}
+
+public:
+    // Fails with OPEN_FAILED until the collector has created the ring
+    static std::expected<ShmLogProducer, ShmRingError> connect(const std::string &name)
+    {
+        auto ring = ShmRing::attach(name);
+        if (!ring)
+        {
+            return std::unexpected(ring.error());
+        }
+        return ShmLogProducer(std::move(*ring));
+    }
+
+    // False if the ring was full (the message is dropped and counted)
+    bool log(const LogMessage &msg) noexcept { return ring.tryPush(msg); }
+
+    // Shared by all producers of the ring
+    [[nodiscard]] std::uint64_t dropped() const noexcept { return ring.dropped(); }
+};
@@ -0,0 +1,80 @@
+#include "TimeSeriesReader.hpp"
+#include <algorithm>
+#include <map>
+
+std::expected<TimeSeriesReader, TimeSeriesError> TimeSeriesReader::open(const std::string &path)
+{
+    MappedFile mapping;
+    if (!mapping.open(path))
+    {
+        return std::unexpected(TimeSeriesError::OPEN_FAILED);
+    }
+    if (mapping.size() < sizeof(tsdb::FileHeader))
+    {
+        return std::unexpected(TimeSeriesError::BAD_HEADER);
+    }
+
+    TimeSeriesReader reader(std::move(mapping));
+    if (!reader.loadIndex())
+    {
+        return std::unexpected(TimeSeriesError::BAD_HEADER);
+    }
+    return reader;
+}
+
+bool TimeSeriesReader::loadIndex()
+{
+    tsdb::FileHeader header;
+    std::memcpy(&header, mapping.data(), sizeof(header));
+    if (header.magic != tsdb::FILE_MAGIC || header.version != tsdb::VERSION || header.chunkBytes == 0)
+    {
+        return false;
+    }
+    chunkBytes = header.chunkBytes;
+
+    const std::size_t stride = sizeof(tsdb::ChunkHeader) + chunkBytes;
+    for (std::size_t offset = sizeof(header); offset + stride <= mapping.size(); offset += stride)
+    {
+        tsdb::ChunkHeader chunk;
+        std::memcpy(&chunk, mapping.data() + offset, sizeof(chunk));
+        if (chunk.magic != tsdb::CHUNK_MAGIC || chunk.bitLength > chunkBytes * 8)
+        {
+            break;
+        }
+        chunkIndex.emplace_back(offset, chunk);
+    }
+    return true;
+}
+
+std::vector<TimeSeriesBucket> TimeSeriesReader::downsample(TelemetrySrc source, TimePoint from, TimePoint to,
+                                                           std::chrono::milliseconds width) const
+{
+    const std::int64_t widthMs = std::max<std::int64_t>(width.count(), 1);
+    std::map<std::int64_t, TimeSeriesBucket> buckets;  // chunks of a source may overlap in time
+
+    scan(source, from, to, [&](TimePoint time, float value) {
+        const std::int64_t ms = std::chrono::duration_cast<std::chrono::milliseconds>(time.time_since_epoch()).count();
+        // Floor division so pre-epoch timestamps land in the right bucket
+        const std::int64_t startMs = (ms >= 0 ? ms : ms - widthMs + 1) / widthMs * widthMs;
+
+        auto [it, inserted] = buckets.try_emplace(startMs);
+        auto &bucket = it->second;
+        if (inserted)
+        {
+            bucket.start = TimePoint(std::chrono::milliseconds(startMs));
+            bucket.min = value;
+            bucket.max = value;
+        }
+        bucket.min = std::min(bucket.min, value);
+        bucket.max = std::max(bucket.max, value);
+        bucket.mean += (value - bucket.mean) / static_cast<double>(++bucket.count);
+    });
+
+    std::vector<TimeSeriesBucket> result;
+    result.reserve(buckets.size());
+    for (auto &[start, bucket] : buckets)
+    {
+        result.push_back(bucket);
+    }
+    return result;
+}
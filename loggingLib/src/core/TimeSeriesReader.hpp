@@ -0,0 +1,91 @@
+#pragma once
+
+#include "LogTypes.hpp"
+#include "sinks/TimeSeriesFormat.hpp"
+#include "utils/GorillaCodec.hpp"
+#include "utils/MappedFile.hpp"
+#include <chrono>
+#include <cstring>
+#include <expected>
+#include <string>
+#include <utility>
+#include <vector>
+
+enum class TimeSeriesError
+{
+    OPEN_FAILED,  // missing, unreadable or could not be mapped
+    BAD_HEADER,
+};
+
+// One downsampled interval; 'start' is aligned to a multiple of the bucket width
+struct TimeSeriesBucket
+{
+    std::chrono::system_clock::time_point start;
+    std::size_t count = 0;
+    float min = 0.0f;
+    float max = 0.0f;
+    double mean = 0.0;
+};
+
+// Read-only mmap view of a file written by TimeSeriesSinkImpl.
+// Chunk headers are indexed on open; scans decode only chunks of the requested
+// source whose time range overlaps the query.
+class TimeSeriesReader
+{
+private:
+    MappedFile mapping;
+    std::size_t chunkBytes = 0;
+    std::vector<std::pair<std::size_t, tsdb::ChunkHeader>> chunkIndex;  // offset, header
+
+    explicit TimeSeriesReader(MappedFile mapping) : mapping(std::move(mapping)) {}
+    bool loadIndex();
+
+public:
+    using TimePoint = std::chrono::system_clock::time_point;
+
+    static std::expected<TimeSeriesReader, TimeSeriesError> open(const std::string &path);
+
+    [[nodiscard]] std::size_t chunkCount() const noexcept { return chunkIndex.size(); }
+
+    // Calls fn(TimePoint, float) for every point of 'source' in [from, to], chunk by chunk
+    // (points are in write order within a chunk). Returns the number of points delivered.
+    template <typename Fn>
+    std::size_t scan(TelemetrySrc source, TimePoint from, TimePoint to, Fn &&fn) const;
+
+    // min/max/mean per 'width' interval over [from, to], ordered by time
+    [[nodiscard]] std::vector<TimeSeriesBucket> downsample(TelemetrySrc source, TimePoint from, TimePoint to,
+                                                           std::chrono::milliseconds width) const;
+};
+
+template <typename Fn>
+std::size_t TimeSeriesReader::scan(TelemetrySrc source, TimePoint from, TimePoint to, Fn &&fn) const
+{
+    const std::int64_t fromMs = std::chrono::duration_cast<std::chrono::milliseconds>(
+                                    from.time_since_epoch()).count();
+    const std::int64_t toMs = std::chrono::duration_cast<std::chrono::milliseconds>(
+                                  to.time_since_epoch()).count();
+    std::size_t delivered = 0;
+
+    for (const auto &[offset, header] : chunkIndex)
+    {
+        if (header.source != static_cast<std::uint8_t>(source) ||
+            header.maxTimeMs < fromMs || header.minTimeMs > toMs)
+        {
+            continue;
+        }
+
+        const auto *data = reinterpret_cast<const std::uint8_t *>(mapping.data() + offset + sizeof(header));
+        GorillaDecoder decoder(data, header.bitLength, header.count);
+        std::int64_t timeMs = 0;
+        float value = 0.0f;
+        while (decoder.next(timeMs, value))
+        {
+            if (timeMs >= fromMs && timeMs <= toMs)
+            {
+                fn(TimePoint(std::chrono::milliseconds(timeMs)), value);
+                ++delivered;
+            }
+        }
+    }
+    return delivered;
+}
@@ -0,0 +1,109 @@
+#include "BinaryFileSinkImpl.hpp"
+#include <algorithm>
+#include <limits>
+
+namespace
+{
+template <typename T>
+void append(std::vector<char> &out, const T &value)
+{
+    const auto *bytes = reinterpret_cast<const char *>(&value);
+    out.insert(out.end(), bytes, bytes + sizeof(T));
+}
+
+binlog::BlockSummary emptySummary()
+{
+    binlog::BlockSummary summary{};
+    summary.minTimeNs = std::numeric_limits<std::int64_t>::max();
+    summary.maxTimeNs = std::numeric_limits<std::int64_t>::min();
+    return summary;
+}
+} // namespace
+
+BinaryFileSinkImpl::BinaryFileSinkImpl(const std::string &path, std::size_t blockBytes)
+    : file(path, std::ios::binary | std::ios::trunc),
+      blockBytes(blockBytes),
+      summary(emptySummary())
+{
+    block.reserve(blockBytes + 256);
+    if (file.is_open())
+    {
+        binlog::FileHeader header{binlog::FILE_MAGIC, binlog::VERSION, 0};
+        file.write(reinterpret_cast<const char *>(&header), sizeof(header));
+        offset = sizeof(header);
+    }
+}
+
+BinaryFileSinkImpl::~BinaryFileSinkImpl()
+{
+    std::lock_guard<std::mutex> lock(writeMutex);
+    if (!file.is_open())
+    {
+        return;
+    }
+    sealBlock();
+
+    binlog::Footer footer{offset, static_cast<std::uint32_t>(index.size()), binlog::FOOTER_MAGIC};
+    file.write(reinterpret_cast<const char *>(index.data()),
+               static_cast<std::streamsize>(index.size() * sizeof(binlog::IndexEntry)));
+    file.write(reinterpret_cast<const char *>(&footer), sizeof(footer));
+}
+
+void BinaryFileSinkImpl::write(const LogMessage &msg)
+{
+    std::lock_guard<std::mutex> lock(writeMutex);
+    if (!file.is_open())
+    {
+        return;
+    }
+
+    const auto &payload = msg.getPayload();
+    const auto value = msg.getValue();
+
+    binlog::RecordHeader record{};
+    record.timeNs = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                        msg.getTime().time_since_epoch())
+                        .count();
+    record.value = value.value_or(0.0f);
+    record.payloadLength = static_cast<std::uint32_t>(payload.size());
+    record.source = static_cast<std::uint8_t>(msg.getSource());
+    record.severity = static_cast<std::uint8_t>(msg.getSeverity());
+    record.flags = value ? binlog::FLAG_HAS_VALUE : 0;
+
+    append(block, record);
+    block.insert(block.end(), payload.begin(), payload.end());
+
+    summary.minTimeNs = std::min(summary.minTimeNs, record.timeNs);
+    summary.maxTimeNs = std::max(summary.maxTimeNs, record.timeNs);
+    summary.severityMask |= binlog::bit(msg.getSeverity());
+    summary.sourceMask |= binlog::bit(msg.getSource());
+    ++summary.recordCount;
+
+    if (block.size() >= blockBytes)
+    {
+        sealBlock();
+    }
+}
+
+void BinaryFileSinkImpl::sealBlock()
+{
+    if (summary.recordCount == 0)
+    {
+        return;
+    }
+
+    binlog::BlockHeader header{binlog::BLOCK_MAGIC, static_cast<std::uint32_t>(block.size()), summary};
+    file.write(reinterpret_cast<const char *>(&header), sizeof(header));
+    file.write(block.data(), static_cast<std::streamsize>(block.size()));
+    file.flush();  // sealed blocks are readable by a linear scan before the footer exists
+
+    index.push_back(binlog::IndexEntry{offset, summary});
+    offset += sizeof(header) + block.size();
+    block.clear();
+    summary = emptySummary();
+}
+
+bool BinaryFileSinkImpl::isOpen() const noexcept
+{
+    return file.is_open();
+}
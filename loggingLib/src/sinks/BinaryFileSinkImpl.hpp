@@ -0,0 +1,41 @@
+#pragma once
+
+#include "interfaces/ILogSink.hpp"
+#include "BinaryLogFormat.hpp"
+#include <fstream>
+#include <string>
+#include <mutex>
+#include <vector>
+
+// Writes LogMessages in the block-indexed binary format (see BinaryLogFormat.hpp).
+// Records are collected into blocks of roughly 'blockBytes'; the last partial block,
+// the index and the footer are written on destruction. The file is truncated on open.
+class BinaryFileSinkImpl : public ILogSink
+{
+private:
+    std::ofstream file;
+    std::mutex writeMutex;
+    std::size_t blockBytes;
+    std::vector<char> block;           // encoded records of the open block
+    binlog::BlockSummary summary{};
+    std::vector<binlog::IndexEntry> index;
+    std::uint64_t offset = 0;          // bytes written to 'file' so far
+
+    void sealBlock();
+
+public:
+    static constexpr std::size_t DEFAULT_BLOCK_BYTES = 64 * 1024;
+
+    BinaryFileSinkImpl() = delete;
+    explicit BinaryFileSinkImpl(const std::string &path, std::size_t blockBytes = DEFAULT_BLOCK_BYTES);
+    ~BinaryFileSinkImpl() override;
+
+    // Non-copyable, non-movable (owns file handle and mutex)
+    BinaryFileSinkImpl(const BinaryFileSinkImpl &) = delete;
+    BinaryFileSinkImpl &operator=(const BinaryFileSinkImpl &) = delete;
+    BinaryFileSinkImpl(BinaryFileSinkImpl &&) = delete;
+    BinaryFileSinkImpl &operator=(BinaryFileSinkImpl &&) = delete;
+
+    void write(const LogMessage &msg) override;
+    [[nodiscard]] bool isOpen() const noexcept;
+};
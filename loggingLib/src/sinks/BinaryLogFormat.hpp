@@ -0,0 +1,94 @@
+#pragma once
+
+// On-disk layout shared by BinaryFileSinkImpl (writer) and BinaryLogReader / logq.
+//
+//   FileHeader
+//   { BlockHeader, RecordHeader + payload bytes, ... } * blocks
+//   IndexEntry * blockCount      -- sparse index, one entry per block
+//   Footer                       -- last 16 bytes of a cleanly closed file
+//
+// Each block summary carries the min/max timestamp and severity/source bitmaps of
+// its records, so a query can skip whole blocks without touching their payload.
+// Integers are stored in host byte order; files are not meant to cross architectures.
+
+#include "LogTypes.hpp"
+#include <array>
+#include <cstdint>
+#include <type_traits>
+#include <magic_enum.hpp>
+
+namespace binlog
+{
+inline constexpr std::array<char, 8> FILE_MAGIC = {'T', 'L', 'O', 'G', 'B', 'I', 'N', '1'};
+inline constexpr std::uint32_t VERSION = 1;
+inline constexpr std::uint32_t BLOCK_MAGIC = 0x4B4C4254;   // "TBLK"
+inline constexpr std::uint32_t FOOTER_MAGIC = 0x58444954;  // "TIDX"
+inline constexpr std::uint8_t FLAG_HAS_VALUE = 0x1;
+
+struct FileHeader
+{
+    std::array<char, 8> magic;
+    std::uint32_t version;
+    std::uint32_t reserved;
+};
+
+struct BlockSummary
+{
+    std::int64_t minTimeNs;
+    std::int64_t maxTimeNs;
+    std::uint32_t severityMask;
+    std::uint32_t sourceMask;
+    std::uint32_t recordCount;
+    std::uint32_t reserved;
+};
+
+struct BlockHeader
+{
+    std::uint32_t magic;
+    std::uint32_t payloadBytes;  // bytes of records following this header
+    BlockSummary summary;
+};
+
+struct RecordHeader
+{
+    std::int64_t timeNs;         // system_clock, nanoseconds since epoch
+    float value;                 // valid when FLAG_HAS_VALUE is set
+    std::uint32_t payloadLength; // payload bytes following this header
+    std::uint8_t source;
+    std::uint8_t severity;
+    std::uint8_t flags;
+    std::uint8_t reserved[5];
+};
+
+struct IndexEntry
+{
+    std::uint64_t offset;  // file offset of the BlockHeader
+    BlockSummary summary;
+};
+
+struct Footer
+{
+    std::uint64_t indexOffset;
+    std::uint32_t blockCount;
+    std::uint32_t magic;
+};
+
+static_assert(sizeof(FileHeader) == 16);
+static_assert(sizeof(BlockSummary) == 32);
+static_assert(sizeof(BlockHeader) == 40);
+static_assert(sizeof(RecordHeader) == 24);
+static_assert(sizeof(IndexEntry) == 40);
+static_assert(sizeof(Footer) == 16);
+static_assert(std::is_trivially_copyable_v<BlockHeader> && std::is_trivially_copyable_v<RecordHeader>);
+
+static_assert(magic_enum::enum_count<SeverityLvl>() <= 32, "severity bitmap is 32 bits");
+static_assert(magic_enum::enum_count<TelemetrySrc>() <= 32, "source bitmap is 32 bits");
+
+inline constexpr std::uint32_t ALL_BITS = 0xFFFFFFFFu;
+
+template <typename Enum>
+[[nodiscard]] constexpr std::uint32_t bit(Enum value) noexcept
+{
+    return 1u << static_cast<std::uint32_t>(value);
+}
+} // namespace binlog
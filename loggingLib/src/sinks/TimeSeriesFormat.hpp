@@ -0,0 +1,43 @@
+#pragma once
+
+// On-disk layout shared by TimeSeriesSinkImpl (writer) and TimeSeriesReader.
+//
+//   FileHeader
+//   { ChunkHeader, chunkBytes of Gorilla-encoded points } * chunks
+//
+// Every chunk has the same size, so chunk i starts at
+// sizeof(FileHeader) + i * (sizeof(ChunkHeader) + chunkBytes) and a torn last chunk
+// is simply ignored. Each chunk holds one source's samples. Integers are host byte order.
+
+#include <array>
+#include <cstdint>
+
+namespace tsdb
+{
+inline constexpr std::array<char, 8> FILE_MAGIC = {'T', 'L', 'O', 'G', 'T', 'S', 'D', '1'};
+inline constexpr std::uint32_t VERSION = 1;
+inline constexpr std::uint32_t CHUNK_MAGIC = 0x4B484354;  // "TCHK"
+
+struct FileHeader
+{
+    std::array<char, 8> magic;
+    std::uint32_t version;
+    std::uint32_t chunkBytes;
+};
+
+struct ChunkHeader
+{
+    std::uint32_t magic;
+    std::uint32_t count;      // points in the chunk
+    std::uint32_t bitLength;  // encoded bits actually used
+    std::uint8_t source;      // TelemetrySrc
+    std::uint8_t reserved[3];
+    std::int64_t minTimeMs;   // system_clock milliseconds since epoch
+    std::int64_t maxTimeMs;
+    float minValue;
+    float maxValue;
+};
+
+static_assert(sizeof(FileHeader) == 16);
+static_assert(sizeof(ChunkHeader) == 40);
+} // namespace tsdb
@@ -0,0 +1,107 @@
+#include "TimeSeriesSinkImpl.hpp"
+#include <algorithm>
+#include <limits>
+#include <magic_enum.hpp>
+
+namespace
+{
+tsdb::ChunkHeader emptyHeader(TelemetrySrc source)
+{
+    tsdb::ChunkHeader header{};
+    header.magic = tsdb::CHUNK_MAGIC;
+    header.source = static_cast<std::uint8_t>(source);
+    header.minTimeMs = std::numeric_limits<std::int64_t>::max();
+    header.maxTimeMs = std::numeric_limits<std::int64_t>::min();
+    header.minValue = std::numeric_limits<float>::max();
+    header.maxValue = std::numeric_limits<float>::lowest();
+    return header;
+}
+} // namespace
+
+TimeSeriesSinkImpl::TimeSeriesSinkImpl(const std::string &path, std::size_t chunkBytes)
+    : file(path, std::ios::binary | std::ios::trunc),
+      chunkBytes(std::max(chunkBytes, MIN_CHUNK_BYTES)),
+      chunks(magic_enum::enum_count<TelemetrySrc>())
+{
+    if (file.is_open())
+    {
+        tsdb::FileHeader header{tsdb::FILE_MAGIC, tsdb::VERSION, static_cast<std::uint32_t>(this->chunkBytes)};
+        file.write(reinterpret_cast<const char *>(&header), sizeof(header));
+    }
+}
+
+TimeSeriesSinkImpl::~TimeSeriesSinkImpl()
+{
+    std::lock_guard<std::mutex> lock(writeMutex);
+    if (!file.is_open())
+    {
+        return;
+    }
+    for (auto &chunk : chunks)
+    {
+        if (chunk)
+        {
+            sealChunk(*chunk);
+        }
+    }
+}
+
+void TimeSeriesSinkImpl::write(const LogMessage &msg)
+{
+    auto value = msg.getValue();
+    if (!value)
+    {
+        return;
+    }
+
+    const std::int64_t timeMs = std::chrono::duration_cast<std::chrono::milliseconds>(
+                                    msg.getTime().time_since_epoch())
+                                    .count();
+    const auto index = magic_enum::enum_index(msg.getSource()).value_or(0);
+
+    std::lock_guard<std::mutex> lock(writeMutex);
+    if (!file.is_open())
+    {
+        return;
+    }
+
+    auto &chunk = chunks[index];
+    if (!chunk)
+    {
+        chunk.emplace(OpenChunk{GorillaEncoder(chunkBytes), emptyHeader(msg.getSource())});
+    }
+    if (!chunk->encoder.append(timeMs, *value))
+    {
+        sealChunk(*chunk);
+        (void)chunk->encoder.append(timeMs, *value);  // always fits in an empty chunk
+    }
+
+    auto &header = chunk->header;
+    header.minTimeMs = std::min(header.minTimeMs, timeMs);
+    header.maxTimeMs = std::max(header.maxTimeMs, timeMs);
+    header.minValue = std::min(header.minValue, *value);
+    header.maxValue = std::max(header.maxValue, *value);
+}
+
+void TimeSeriesSinkImpl::sealChunk(OpenChunk &chunk)
+{
+    if (chunk.encoder.count() == 0)
+    {
+        return;
+    }
+
+    chunk.header.count = chunk.encoder.count();
+    chunk.header.bitLength = static_cast<std::uint32_t>(chunk.encoder.bitLength());
+    file.write(reinterpret_cast<const char *>(&chunk.header), sizeof(chunk.header));
+    file.write(reinterpret_cast<const char *>(chunk.encoder.bytes().data()),
+               static_cast<std::streamsize>(chunkBytes));
+    file.flush();
+
+    chunk.encoder.reset();
+    chunk.header = emptyHeader(static_cast<TelemetrySrc>(chunk.header.source));
+}
+
+bool TimeSeriesSinkImpl::isOpen() const noexcept
+{
+    return file.is_open();
+}
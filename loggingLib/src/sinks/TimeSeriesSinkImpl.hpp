@@ -0,0 +1,48 @@
+#pragma once
+
+#include "interfaces/ILogSink.hpp"
+#include "TimeSeriesFormat.hpp"
+#include "utils/GorillaCodec.hpp"
+#include <fstream>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <vector>
+
+// Writes the numeric sample of each LogMessage as a per-source compressed time series
+// (see TimeSeriesFormat.hpp); messages without a value are skipped. Timestamps keep
+// millisecond resolution. Open chunks are written on destruction; the file is
+// truncated on open. Read back with TimeSeriesReader.
+class TimeSeriesSinkImpl : public ILogSink
+{
+private:
+    struct OpenChunk
+    {
+        GorillaEncoder encoder;
+        tsdb::ChunkHeader header;
+    };
+
+    std::ofstream file;
+    std::mutex writeMutex;
+    std::size_t chunkBytes;
+    std::vector<std::optional<OpenChunk>> chunks;  // indexed by TelemetrySrc
+
+    void sealChunk(OpenChunk &chunk);
+
+public:
+    static constexpr std::size_t DEFAULT_CHUNK_BYTES = 4096;
+    static constexpr std::size_t MIN_CHUNK_BYTES = 64;  // smaller sizes are rounded up
+
+    TimeSeriesSinkImpl() = delete;
+    explicit TimeSeriesSinkImpl(const std::string &path, std::size_t chunkBytes = DEFAULT_CHUNK_BYTES);
+    ~TimeSeriesSinkImpl() override;
+
+    // Non-copyable, non-movable (owns file handle and mutex)
+    TimeSeriesSinkImpl(const TimeSeriesSinkImpl &) = delete;
+    TimeSeriesSinkImpl &operator=(const TimeSeriesSinkImpl &) = delete;
+    TimeSeriesSinkImpl(TimeSeriesSinkImpl &&) = delete;
+    TimeSeriesSinkImpl &operator=(TimeSeriesSinkImpl &&) = delete;
+
+    void write(const LogMessage &msg) override;
+    [[nodiscard]] bool isOpen() const noexcept;
+};
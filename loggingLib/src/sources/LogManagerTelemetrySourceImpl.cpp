@@ -0,0 +1,44 @@
+#include "LogManagerTelemetrySourceImpl.hpp"
+#include <algorithm>
+
+LogManagerTelemetrySourceImpl::LogManagerTelemetrySourceImpl(const LogManager& manager, LoggerMetric metric)
+    : manager(manager), metric(metric) {}
+
+bool LogManagerTelemetrySourceImpl::openSource() {
+    const LogManagerStats stats = manager.stats();
+    lastDropped = stats.dropped + stats.overwritten;
+    return true;
+}
+
+bool LogManagerTelemetrySourceImpl::readSource(std::string& out) {
+    const LogManagerStats stats = manager.stats();
+    using Millis = std::chrono::duration<double, std::milli>;
+    double value = 0.0;
+
+    switch (metric) {
+    case LoggerMetric::QUEUE_FILL:
+        value = stats.bufferCapacity
+            ? 100.0 * static_cast<double>(stats.bufferDepth) / static_cast<double>(stats.bufferCapacity)
+            : 0.0;
+        break;
+    case LoggerMetric::DROPS:
+        // Overwritten messages are lost just the same
+        value = static_cast<double>(stats.dropped + stats.overwritten - lastDropped);
+        lastDropped = stats.dropped + stats.overwritten;
+        break;
+    case LoggerMetric::FLUSH_DURATION:
+        value = Millis(stats.lastFlushDuration).count();
+        break;
+    case LoggerMetric::POOL_BACKLOG:
+        value = static_cast<double>(stats.poolBacklog);
+        break;
+    case LoggerMetric::SINK_LATENCY:
+        if (!stats.sinkWriteLatency.empty()) {
+            value = Millis(*std::max_element(stats.sinkWriteLatency.begin(), stats.sinkWriteLatency.end())).count();
+        }
+        break;
+    }
+
+    out = std::to_string(value);
+    return true;
+}
@@ -0,0 +1,20 @@
+#pragma once
+
+#include "interfaces/ITelemetrySource.hpp"
+#include "LogManager.hpp"
+#include "LogTypes.hpp"
+
+// Reads one of the LogManager's own health metrics, so backpressure and
+// saturation can be formatted and logged like any other telemetry
+// (pair with LogQueuePolicy, LogDropPolicy, LogFlushPolicy, ...).
+class LogManagerTelemetrySourceImpl : public ITelemetrySource {
+private:
+    const LogManager& manager;
+    LoggerMetric metric;
+    std::uint64_t lastDropped = 0;
+
+public:
+    LogManagerTelemetrySourceImpl(const LogManager& manager, LoggerMetric metric);
+    bool openSource() override;
+    bool readSource(std::string& out) override;
+};
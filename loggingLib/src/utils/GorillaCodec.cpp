@@ -0,0 +1,255 @@
+#include "GorillaCodec.hpp"
+#include <algorithm>
+#include <bit>
+
+namespace
+{
+struct DodBucket
+{
+    std::uint64_t prefix;
+    unsigned prefixBits;
+    unsigned valueBits;
+    std::int64_t bias;  // stored value is dod + bias, always non-negative
+};
+
+// '0' covers dod == 0; these follow, the 64-bit escape comes last
+constexpr DodBucket DOD_BUCKETS[] = {
+    {0b10, 2, 7, 63},
+    {0b110, 3, 9, 255},
+    {0b1110, 4, 12, 2047},
+};
+constexpr std::uint64_t DOD_ESCAPE = 0b1111;
+} // namespace
+
+GorillaEncoder::GorillaEncoder(std::size_t capacityBytes)
+    : buffer(capacityBytes, 0)
+{
+}
+
+void GorillaEncoder::reset()
+{
+    std::fill(buffer.begin(), buffer.end(), 0);
+    bitPos = 0;
+    points = 0;
+    prevTime = 0;
+    prevDelta = 0;
+    prevBits = 0;
+    prevLeading = 0xFF;
+    prevTrailing = 0;
+}
+
+void GorillaEncoder::writeBits(std::uint64_t value, unsigned count)
+{
+    // MSB first into a zeroed buffer, up to one byte per step
+    while (count > 0)
+    {
+        const unsigned freeBits = 8 - (bitPos & 7);
+        const unsigned take = std::min(freeBits, count);
+        const auto chunk = static_cast<std::uint8_t>((value >> (count - take)) & ((1u << take) - 1));
+        buffer[bitPos >> 3] |= static_cast<std::uint8_t>(chunk << (freeBits - take));
+        bitPos += take;
+        count -= take;
+    }
+}
+
+void GorillaEncoder::encodeTimestamp(std::int64_t timeMs)
+{
+    const std::int64_t delta = timeMs - prevTime;
+    const std::int64_t dod = delta - prevDelta;
+    prevTime = timeMs;
+    prevDelta = delta;
+
+    if (dod == 0)
+    {
+        writeBits(0, 1);
+        return;
+    }
+    for (const auto &bucket : DOD_BUCKETS)
+    {
+        const std::int64_t limit = std::int64_t{1} << (bucket.valueBits - 1);
+        if (dod >= -(limit - 1) && dod <= limit)
+        {
+            writeBits(bucket.prefix, bucket.prefixBits);
+            writeBits(static_cast<std::uint64_t>(dod + bucket.bias), bucket.valueBits);
+            return;
+        }
+    }
+    writeBits(DOD_ESCAPE, 4);
+    writeBits(static_cast<std::uint64_t>(dod), 64);
+}
+
+void GorillaEncoder::encodeValue(std::uint32_t bits)
+{
+    const std::uint32_t x = bits ^ prevBits;
+    prevBits = bits;
+
+    if (x == 0)
+    {
+        writeBits(0, 1);
+        return;
+    }
+    writeBits(1, 1);
+
+    const auto leading = static_cast<std::uint8_t>(std::countl_zero(x));
+    const auto trailing = static_cast<std::uint8_t>(std::countr_zero(x));
+    if (prevLeading != 0xFF && leading >= prevLeading && trailing >= prevTrailing)
+    {
+        // Fits in the previous window: reuse its position, skip the header
+        writeBits(0, 1);
+        writeBits(x >> prevTrailing, 32u - prevLeading - prevTrailing);
+        return;
+    }
+
+    const unsigned meaningful = 32u - leading - trailing;
+    writeBits(1, 1);
+    writeBits(leading, 5);
+    writeBits(meaningful - 1, 5);
+    writeBits(x >> trailing, meaningful);
+    prevLeading = leading;
+    prevTrailing = trailing;
+}
+
+bool GorillaEncoder::append(std::int64_t timeMs, float value)
+{
+    if (bitPos + MAX_POINT_BITS > buffer.size() * 8)
+    {
+        return false;
+    }
+
+    const auto bits = std::bit_cast<std::uint32_t>(value);
+    if (points == 0)
+    {
+        writeBits(static_cast<std::uint64_t>(timeMs), 64);
+        writeBits(bits, 32);
+        prevTime = timeMs;
+        prevBits = bits;
+    }
+    else
+    {
+        encodeTimestamp(timeMs);
+        encodeValue(bits);
+    }
+    ++points;
+    return true;
+}
+
+GorillaDecoder::GorillaDecoder(const std::uint8_t *data, std::size_t bitLength, std::uint32_t count)
+    : data(data), bitLength(bitLength), remaining(count)
+{
+}
+
+bool GorillaDecoder::readBits(unsigned count, std::uint64_t &out)
+{
+    if (bitPos + count > bitLength)
+    {
+        return false;
+    }
+    out = 0;
+    while (count > 0)
+    {
+        const unsigned available = 8 - (bitPos & 7);
+        const unsigned take = std::min(available, count);
+        const unsigned chunk = (data[bitPos >> 3] >> (available - take)) & ((1u << take) - 1);
+        out = (out << take) | chunk;
+        bitPos += take;
+        count -= take;
+    }
+    return true;
+}
+
+bool GorillaDecoder::next(std::int64_t &timeMs, float &value)
+{
+    if (remaining == 0)
+    {
+        return false;
+    }
+
+    std::uint64_t bits = 0;
+    if (first)
+    {
+        std::uint64_t raw = 0;
+        if (!readBits(64, raw) || !readBits(32, bits))
+        {
+            return false;
+        }
+        first = false;
+        prevTime = static_cast<std::int64_t>(raw);
+        prevBits = static_cast<std::uint32_t>(bits);
+    }
+    else
+    {
+        // Timestamp: count leading 1s of the prefix (max 4)
+        unsigned ones = 0;
+        std::uint64_t bit = 0;
+        while (ones < 4)
+        {
+            if (!readBits(1, bit))
+            {
+                return false;
+            }
+            if (bit == 0)
+            {
+                break;
+            }
+            ++ones;
+        }
+
+        std::int64_t dod = 0;
+        if (ones == 4)
+        {
+            std::uint64_t raw = 0;
+            if (!readBits(64, raw))
+            {
+                return false;
+            }
+            dod = static_cast<std::int64_t>(raw);
+        }
+        else if (ones > 0)
+        {
+            const auto &bucket = DOD_BUCKETS[ones - 1];
+            std::uint64_t raw = 0;
+            if (!readBits(bucket.valueBits, raw))
+            {
+                return false;
+            }
+            dod = static_cast<std::int64_t>(raw) - bucket.bias;
+        }
+        prevDelta += dod;
+        prevTime += prevDelta;
+
+        // Value
+        if (!readBits(1, bit))
+        {
+            return false;
+        }
+        if (bit == 1)
+        {
+            if (!readBits(1, bit))
+            {
+                return false;
+            }
+            if (bit == 1)
+            {
+                std::uint64_t leading = 0;
+                std::uint64_t length = 0;
+                if (!readBits(5, leading) || !readBits(5, length))
+                {
+                    return false;
+                }
+                prevLeading = static_cast<std::uint8_t>(leading);
+                prevTrailing = static_cast<std::uint8_t>(32 - leading - (length + 1));
+            }
+            const unsigned meaningful = 32u - prevLeading - prevTrailing;
+            if (meaningful == 0 || meaningful > 32 || !readBits(meaningful, bits))
+            {
+                return false;
+            }
+            prevBits ^= static_cast<std::uint32_t>(bits) << prevTrailing;
+        }
+    }
+
+    --remaining;
+    timeMs = prevTime;
+    value = std::bit_cast<float>(prevBits);
+    return true;
+}
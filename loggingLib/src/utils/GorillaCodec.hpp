@@ -0,0 +1,65 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Gorilla-style compression of one (timestamp, float) series into a fixed-size buffer
+// (Pelkonen et al., "Gorilla: A Fast, Scalable, In-Memory Time Series Database").
+//
+// Timestamps are integer milliseconds encoded as delta-of-delta with variable-width
+// buckets; values are XORed with the previous sample and only the meaningful bits kept.
+// A regular 1 s series with slowly moving values costs roughly 1-3 bytes per point.
+class GorillaEncoder
+{
+private:
+    std::vector<std::uint8_t> buffer;
+    std::size_t bitPos = 0;
+    std::uint32_t points = 0;
+    std::int64_t prevTime = 0;
+    std::int64_t prevDelta = 0;
+    std::uint32_t prevBits = 0;
+    std::uint8_t prevLeading = 0xFF;  // 0xFF: no XOR window yet
+    std::uint8_t prevTrailing = 0;
+
+    void writeBits(std::uint64_t value, unsigned count);
+    void encodeTimestamp(std::int64_t timeMs);
+    void encodeValue(std::uint32_t bits);
+
+public:
+    // Worst case for one point: 4 + 64 timestamp bits, 2 + 5 + 5 + 32 value bits
+    static constexpr std::size_t MAX_POINT_BITS = 112;
+
+    explicit GorillaEncoder(std::size_t capacityBytes);
+
+    // False when the buffer might not hold another point; the caller seals and resets
+    [[nodiscard]] bool append(std::int64_t timeMs, float value);
+    void reset();
+
+    [[nodiscard]] const std::vector<std::uint8_t> &bytes() const noexcept { return buffer; }
+    [[nodiscard]] std::size_t bitLength() const noexcept { return bitPos; }
+    [[nodiscard]] std::uint32_t count() const noexcept { return points; }
+};
+
+class GorillaDecoder
+{
+private:
+    const std::uint8_t *data;
+    std::size_t bitLength;
+    std::size_t bitPos = 0;
+    std::uint32_t remaining;
+    bool first = true;
+    std::int64_t prevTime = 0;
+    std::int64_t prevDelta = 0;
+    std::uint32_t prevBits = 0;
+    std::uint8_t prevLeading = 0;
+    std::uint8_t prevTrailing = 0;
+
+    bool readBits(unsigned count, std::uint64_t &out);
+
+public:
+    GorillaDecoder(const std::uint8_t *data, std::size_t bitLength, std::uint32_t count);
+
+    // False at the end of the series or on a truncated stream
+    [[nodiscard]] bool next(std::int64_t &timeMs, float &value);
+};
@@ -0,0 +1,62 @@
+#include "MappedFile.hpp"
+#include "SafeFile.hpp"
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <utility>
+
+MappedFile::MappedFile() : base(nullptr), length(0) {}
+
+MappedFile::~MappedFile() {
+    close();
+}
+
+MappedFile::MappedFile(MappedFile&& other) noexcept
+    : base(std::exchange(other.base, nullptr)), length(std::exchange(other.length, 0)) {}
+
+MappedFile& MappedFile::operator=(MappedFile&& other) noexcept {
+    if (this != &other) {
+        close();
+        base = std::exchange(other.base, nullptr);
+        length = std::exchange(other.length, 0);
+    }
+    return *this;
+}
+
+bool MappedFile::open(const std::string& path) {
+    close();
+    SafeFile file(path, O_RDONLY);
+    if (!file.isValid()) return false;
+
+    struct stat info{};
+    if (::fstat(file.get(), &info) != 0) return false;
+    if (info.st_size == 0) return true;
+
+    void* mapping = ::mmap(nullptr, static_cast<std::size_t>(info.st_size), PROT_READ, MAP_PRIVATE, file.get(), 0);
+    if (mapping == MAP_FAILED) return false;
+
+    // Readers jump between headers and selected blocks; readahead would pull in the rest
+    ::madvise(mapping, static_cast<std::size_t>(info.st_size), MADV_RANDOM);
+    base = static_cast<const char*>(mapping);
+    length = static_cast<std::size_t>(info.st_size);
+    return true;
+}
+
+bool MappedFile::isValid() const {
+    return base != nullptr;
+}
+
+const char* MappedFile::data() const {
+    return base;
+}
+
+std::size_t MappedFile::size() const {
+    return length;
+}
+
+void MappedFile::close() {
+    if (base) {
+        ::munmap(const_cast<char*>(base), length);
+        base = nullptr;
+        length = 0;
+    }
+}
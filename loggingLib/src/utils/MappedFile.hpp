@@ -0,0 +1,28 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+// RAII read-only mmap of a whole file
+class MappedFile {
+private:
+    const char* base;
+    std::size_t length;
+
+public:
+    MappedFile();
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    MappedFile(MappedFile&& other) noexcept;
+    MappedFile& operator=(MappedFile&& other) noexcept;
+
+    // An empty file opens successfully with data() == nullptr
+    bool open(const std::string& path);
+    bool isValid() const;
+    const char* data() const;
+    std::size_t size() const;
+    void close();
+};
@@ -27,6 +27,10 @@ bool SafeFile::isValid() const {
     return fd >= 0;
 }
 
+int SafeFile::get() const {
+    return fd;
+}
+
 bool SafeFile::open(const std::string& path, int flags, mode_t mode) {
     close();
     fd = ::open(path.c_str(), flags, mode);
@@ -20,6 +20,7 @@ public:
     SafeFile& operator=(SafeFile&& other) noexcept;
 
     bool isValid() const;
+    int get() const;
     bool open(const std::string& path, int flags, mode_t mode = 0644);
     bool readAll(std::string& out) const;
     void close();
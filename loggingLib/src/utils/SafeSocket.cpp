@@ -1,6 +1,18 @@
 #include "SafeSocket.hpp"
 #include <cstring>
+#include <cerrno>
 #include <utility>
+#include <poll.h>
+
+namespace {
+struct sockaddr_un makeAddress(const std::string& socketPath) {
+    struct sockaddr_un addr;
+    std::memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    std::strncpy(addr.sun_path, socketPath.c_str(), sizeof(addr.sun_path) - 1);
+    return addr;
+}
+}
 
 SafeSocket::SafeSocket() : sockfd(-1) {}
 
@@ -36,14 +48,40 @@ bool SafeSocket::create(int type) {
 bool SafeSocket::connect(const std::string& socketPath) {
     if (!isValid()) return false;
 
-    struct sockaddr_un addr;
-    std::memset(&addr, 0, sizeof(addr));
-    addr.sun_family = AF_UNIX;
-    std::strncpy(addr.sun_path, socketPath.c_str(), sizeof(addr.sun_path) - 1);
-
+    struct sockaddr_un addr = makeAddress(socketPath);
     return ::connect(sockfd, reinterpret_cast<struct sockaddr*>(&addr), sizeof(addr)) == 0;
 }
 
+bool SafeSocket::bind(const std::string& socketPath) {
+    if (!isValid()) return false;
+
+    struct sockaddr_un addr = makeAddress(socketPath);
+    return ::bind(sockfd, reinterpret_cast<struct sockaddr*>(&addr), sizeof(addr)) == 0;
+}
+
+bool SafeSocket::listen(int backlog) {
+    if (!isValid()) return false;
+    return ::listen(sockfd, backlog) == 0;
+}
+
+bool SafeSocket::accept(SafeSocket& client) const {
+    if (!isValid()) return false;
+
+    int fd = ::accept4(sockfd, nullptr, nullptr, SOCK_CLOEXEC);
+    if (fd < 0) return false;
+
+    client.close();
+    client.sockfd = fd;
+    return true;
+}
+
+bool SafeSocket::waitReadable(int timeoutMs) const {
+    if (!isValid()) return false;
+
+    struct pollfd pfd{sockfd, POLLIN, 0};
+    return ::poll(&pfd, 1, timeoutMs) > 0 && (pfd.revents & POLLIN);
+}
+
 bool SafeSocket::readString(std::string& out, size_t maxSize) const {
     if (!isValid()) return false;
 
@@ -58,6 +96,21 @@ bool SafeSocket::readString(std::string& out, size_t maxSize) const {
     return true;
 }
 
+bool SafeSocket::writeString(std::string_view data) const {
+    if (!isValid()) return false;
+
+    while (!data.empty()) {
+        // MSG_NOSIGNAL: a peer that hung up must not SIGPIPE the whole process
+        ssize_t sent = ::send(sockfd, data.data(), data.size(), MSG_NOSIGNAL);
+        if (sent < 0) {
+            if (errno == EINTR) continue;
+            return false;
+        }
+        data.remove_prefix(static_cast<size_t>(sent));
+    }
+    return true;
+}
+
 void SafeSocket::close() {
     if (isValid()) {
         ::close(sockfd);
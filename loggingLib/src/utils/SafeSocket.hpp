@@ -4,6 +4,7 @@
 #include <sys/un.h>
 #include <unistd.h>
 #include <string>
+#include <string_view>
 
 class SafeSocket {
 private:
@@ -23,6 +24,11 @@ public:
     bool isValid() const;
     bool create(int type);
     bool connect(const std::string& socketPath);
+    bool bind(const std::string& socketPath);
+    bool listen(int backlog = 8);
+    bool accept(SafeSocket& client) const;
+    bool waitReadable(int timeoutMs) const;
     bool readString(std::string& out, size_t maxSize = 4096) const;
+    bool writeString(std::string_view data) const;
     void close();
 };
@@ -0,0 +1,50 @@
+#include "ThreadTuning.hpp"
+#include <pthread.h>
+#include <sched.h>
+#include <sys/resource.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <cstring>
+
+namespace {
+// From linux/ioprio.h, which glibc does not wrap
+constexpr int IOPRIO_WHO_PROCESS = 1;
+constexpr int IOPRIO_CLASS_IDLE = 3;
+constexpr int IOPRIO_CLASS_SHIFT = 13;
+constexpr std::size_t THREAD_NAME_MAX = 15;
+} // namespace
+
+bool applyThreadTuning(const ThreadTuning& tuning) {
+    bool ok = true;
+
+    if (!tuning.cpus.empty()) {
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        for (int cpu : tuning.cpus) {
+            if (cpu >= 0 && cpu < CPU_SETSIZE) CPU_SET(cpu, &set);
+        }
+        ok &= pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0;
+    }
+
+    if (tuning.idleScheduling) {
+        sched_param param{};
+        ok &= pthread_setschedparam(pthread_self(), SCHED_IDLE, &param) == 0;
+    }
+
+    // On Linux nice and ioprio are per thread when addressed by thread id
+    const auto tid = static_cast<id_t>(syscall(SYS_gettid));
+    if (tuning.nice) {
+        ok &= setpriority(PRIO_PROCESS, tid, *tuning.nice) == 0;
+    }
+
+    if (tuning.idleIo) {
+        ok &= syscall(SYS_ioprio_set, IOPRIO_WHO_PROCESS, tid, IOPRIO_CLASS_IDLE << IOPRIO_CLASS_SHIFT) == 0;
+    }
+    return ok;
+}
+
+void setThreadName(const char* name) {
+    char truncated[THREAD_NAME_MAX + 1] = {};
+    std::strncpy(truncated, name, THREAD_NAME_MAX);
+    pthread_setname_np(pthread_self(), truncated);
+}
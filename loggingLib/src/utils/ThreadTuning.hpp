@@ -0,0 +1,22 @@
+#pragma once
+
+#include <optional>
+#include <vector>
+
+// OS-level placement of a background thread, so logging stays off the cores and
+// the disk time of the workload it observes. Linux only; every field is optional.
+struct ThreadTuning {
+    std::vector<int> cpus;       // pin to these CPUs; empty: any
+    bool idleScheduling = false; // SCHED_IDLE: runs only when a CPU has nothing else to do
+    std::optional<int> nice;     // -20..19, for SCHED_OTHER threads
+    bool idleIo = false;         // ioprio IDLE class: disk time only when nobody else wants it
+
+    bool empty() const { return cpus.empty() && !idleScheduling && !nice && !idleIo; }
+};
+
+// Applies 'tuning' to the calling thread. Best effort: each setting is tried on its
+// own, and the result is false if any was refused (e.g. EPERM when lowering nice).
+bool applyThreadTuning(const ThreadTuning& tuning);
+
+// Names the calling thread for top/ps/gdb; longer names are cut to 15 characters
+void setThreadName(const char* name);
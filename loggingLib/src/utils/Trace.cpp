@@ -0,0 +1,241 @@
+#include "Trace.hpp"
+
+#ifdef LOGGING_ENABLE_TRACING
+
+#include <algorithm>
+#include <atomic>
+#include <deque>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <vector>
+#include <unistd.h>
+
+namespace trace
+{
+namespace
+{
+constexpr std::size_t EVENTS_PER_THREAD = 1 << 16;  // power of two: the ring index is masked
+constexpr std::size_t MAX_RETIRED = 16;             // exited threads' buffers kept for the next dump
+
+// Atomic fields so the dumper may read a slot the owner is overwriting; it discards those
+struct Event
+{
+    std::atomic<const char *> name{nullptr};
+    std::atomic<std::int64_t> startNs{0};
+    std::atomic<std::int64_t> durationNs{0};
+};
+
+// A ring of the owning thread's latest spans. Single writer: 'claimed' moves before a
+// slot is overwritten and 'published' after, so the dumper can tell which slots it read
+// intact (seqlock-style).
+struct ThreadBuffer
+{
+    enum class State
+    {
+        LIVE,     // owned by a running thread
+        RETIRED,  // its thread exited; spans kept until the next dump
+        SPARE,    // dumped (or given up), ready for a new thread
+    };
+
+    long tid = 0;                  // guarded by the registry mutex
+    State state = State::LIVE;     // guarded by the registry mutex
+    std::unique_ptr<Event[]> events = std::make_unique<Event[]>(EVENTS_PER_THREAD);
+    std::atomic<std::uint64_t> claimed{0};
+    std::atomic<std::uint64_t> published{0};
+
+    // Spans pushed out of the ring by newer ones
+    [[nodiscard]] std::uint64_t overwritten() const noexcept
+    {
+        const std::uint64_t count = published.load(std::memory_order_relaxed);
+        return count > EVENTS_PER_THREAD ? count - EVENTS_PER_THREAD : 0;
+    }
+};
+
+// Buffers outlive their threads until the next dump, so spans from finished workers still
+// get dumped; then they are reused. Memory stays at one buffer per live thread plus
+// MAX_RETIRED, however many workers an elastic pool retires and spawns.
+struct Registry
+{
+    std::mutex mutex;
+    std::vector<std::unique_ptr<ThreadBuffer>> buffers;  // every buffer, in any state
+    std::deque<ThreadBuffer *> retired;                  // oldest first
+    std::vector<ThreadBuffer *> spare;
+    std::uint64_t lost = 0;                              // spans of reused buffers never dumped
+
+    ThreadBuffer *acquire(long tid)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        ThreadBuffer *buffer = nullptr;
+        if (!spare.empty())
+        {
+            buffer = spare.back();
+            spare.pop_back();
+        }
+        else
+        {
+            buffers.push_back(std::make_unique<ThreadBuffer>());
+            buffer = buffers.back().get();
+        }
+        buffer->tid = tid;
+        buffer->state = ThreadBuffer::State::LIVE;
+        return buffer;
+    }
+
+    void release(ThreadBuffer *buffer)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        buffer->state = ThreadBuffer::State::RETIRED;
+        retired.push_back(buffer);
+        if (retired.size() > MAX_RETIRED)
+        {
+            ThreadBuffer *oldest = retired.front();
+            retired.pop_front();
+            lost += std::min<std::uint64_t>(oldest->published.load(std::memory_order_relaxed), EVENTS_PER_THREAD);
+            recycle(oldest);
+        }
+    }
+
+    // Caller holds the mutex; nobody writes the buffer any more
+    void recycle(ThreadBuffer *buffer)
+    {
+        lost += buffer->overwritten();
+        buffer->claimed.store(0, std::memory_order_relaxed);
+        buffer->published.store(0, std::memory_order_relaxed);
+        buffer->state = ThreadBuffer::State::SPARE;
+        spare.push_back(buffer);
+    }
+};
+
+Registry &registry()
+{
+    static Registry instance;
+    return instance;
+}
+
+// Fast path, trivially destructible so spans recorded by other thread_local destructors
+// after the buffer went back are simply skipped
+thread_local ThreadBuffer *cachedBuffer = nullptr;
+thread_local bool threadExited = false;
+
+// Hands the thread's buffer back to the registry when the thread exits
+struct BufferOwner
+{
+    ThreadBuffer *buffer = nullptr;
+
+    ~BufferOwner()
+    {
+        cachedBuffer = nullptr;
+        threadExited = true;
+        if (buffer)
+        {
+            registry().release(buffer);
+        }
+    }
+};
+
+ThreadBuffer *localBuffer()
+{
+    if (cachedBuffer || threadExited)
+    {
+        return cachedBuffer;
+    }
+    thread_local BufferOwner owner;
+    owner.buffer = registry().acquire(static_cast<long>(::gettid()));
+    cachedBuffer = owner.buffer;
+    return cachedBuffer;
+}
+} // namespace
+
+void record(const char *name, std::int64_t startNs, std::int64_t endNs) noexcept
+{
+    ThreadBuffer *buffer = localBuffer();
+    if (!buffer)
+    {
+        return;
+    }
+    const std::uint64_t index = buffer->published.load(std::memory_order_relaxed);
+    Event &event = buffer->events[index & (EVENTS_PER_THREAD - 1)];
+    buffer->claimed.store(index + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    event.name.store(name, std::memory_order_relaxed);
+    event.startNs.store(startNs, std::memory_order_relaxed);
+    event.durationNs.store(endNs - startNs, std::memory_order_relaxed);
+    buffer->published.store(index + 1, std::memory_order_release);
+}
+
+bool dumpChromeTrace(const std::string &path)
+{
+    std::ofstream out(path);
+    if (!out)
+    {
+        return false;
+    }
+
+    struct Copied
+    {
+        const char *name;
+        std::int64_t startNs;
+        std::int64_t durationNs;
+    };
+    std::vector<Copied> copied;
+    copied.reserve(EVENTS_PER_THREAD);
+
+    const long pid = static_cast<long>(::getpid());
+    out << "{\"displayTimeUnit\": \"ns\", \"traceEvents\": [";
+    bool first = true;
+
+    auto &reg = registry();
+    std::lock_guard<std::mutex> lock(reg.mutex);
+    std::uint64_t dropped = reg.lost;
+    out.setf(std::ios::fixed);
+    out.precision(3);
+    for (const auto &buffer : reg.buffers)
+    {
+        if (buffer->state == ThreadBuffer::State::SPARE)
+        {
+            continue;
+        }
+
+        // The newest EVENTS_PER_THREAD spans, minus any the owner overwrote while we read
+        const std::uint64_t end = buffer->published.load(std::memory_order_acquire);
+        std::uint64_t begin = end > EVENTS_PER_THREAD ? end - EVENTS_PER_THREAD : 0;
+        copied.clear();
+        for (std::uint64_t i = begin; i < end; ++i)
+        {
+            const Event &event = buffer->events[i & (EVENTS_PER_THREAD - 1)];
+            copied.push_back(Copied{event.name.load(std::memory_order_relaxed),
+                                    event.startNs.load(std::memory_order_relaxed),
+                                    event.durationNs.load(std::memory_order_relaxed)});
+        }
+        std::atomic_thread_fence(std::memory_order_acquire);
+        const std::uint64_t claimed = buffer->claimed.load(std::memory_order_relaxed);
+        const std::uint64_t intact = claimed > EVENTS_PER_THREAD ? claimed - EVENTS_PER_THREAD : 0;
+        const std::size_t skip = static_cast<std::size_t>(std::min(std::max(intact, begin) - begin, end - begin));
+        dropped += buffer->overwritten() + skip;
+
+        for (std::size_t i = skip; i < copied.size(); ++i)
+        {
+            const Copied &event = copied[i];
+            // Chrome expects microseconds
+            out << (first ? "\n" : ",\n")
+                << "{\"name\": \"" << event.name << "\", \"ph\": \"X\", \"pid\": " << pid
+                << ", \"tid\": " << buffer->tid
+                << ", \"ts\": " << static_cast<double>(event.startNs) / 1000.0
+                << ", \"dur\": " << static_cast<double>(event.durationNs) / 1000.0 << '}';
+            first = false;
+        }
+    }
+
+    // Exited threads' spans are out now; their buffers can serve new threads
+    for (ThreadBuffer *buffer : reg.retired)
+    {
+        reg.recycle(buffer);
+    }
+    reg.retired.clear();
+    out << "\n], \"otherData\": {\"dropped_spans\": " << dropped << "}}\n";
+    return static_cast<bool>(out);
+}
+} // namespace trace
+
+#endif
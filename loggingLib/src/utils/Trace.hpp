@@ -0,0 +1,69 @@
+#pragma once
+
+// Pipeline tracing in Chrome trace-event format (open in ui.perfetto.dev or chrome://tracing).
+//
+// Build with LOGGING_ENABLE_TRACING (CMake: -DLOGGING_ENABLE_TRACING=ON,
+// Bazel: --config=tracing) to record spans; otherwise LOG_TRACE_SPAN expands to
+// nothing and dumpChromeTrace() is a stub returning false.
+//
+// Each thread records into its own fixed-size ring (no locks, no allocation after the
+// thread's first span) that keeps its latest spans, so a dump shows recent activity.
+// An exited thread's ring is kept until the next dump, then reused by a new thread.
+
+#include <string>
+
+#define LOG_TRACE_CONCAT_IMPL(a, b) a##b
+#define LOG_TRACE_CONCAT(a, b) LOG_TRACE_CONCAT_IMPL(a, b)
+
+#ifdef LOGGING_ENABLE_TRACING
+
+#include <chrono>
+#include <cstdint>
+
+namespace trace
+{
+// 'name' must be a string literal (only the pointer is stored)
+void record(const char *name, std::int64_t startNs, std::int64_t endNs) noexcept;
+
+inline std::int64_t nowNs() noexcept
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+// RAII span: records [construction, destruction) on the current thread
+class Span
+{
+private:
+    const char *name;
+    std::int64_t start;
+
+public:
+    explicit Span(const char *name) noexcept : name(name), start(nowNs()) {}
+    ~Span() { record(name, start, nowNs()); }
+
+    Span(const Span &) = delete;
+    Span &operator=(const Span &) = delete;
+};
+
+// Writes the spans still held as Chrome trace JSON; safe while threads keep tracing.
+// 'dropped_spans' counts those already overwritten or given up.
+bool dumpChromeTrace(const std::string &path);
+} // namespace trace
+
+#define LOG_TRACE_SPAN(name) ::trace::Span LOG_TRACE_CONCAT(logTraceSpan_, __LINE__)(name)
+
+#else
+
+namespace trace
+{
+inline bool dumpChromeTrace(const std::string &)
+{
+    return false;
+}
+} // namespace trace
+
+#define LOG_TRACE_SPAN(name) ((void)0)
+
+#endif
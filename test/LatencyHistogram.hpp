@@ -0,0 +1,90 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <ostream>
+
+// Lock-free log-linear latency histogram (microsecond resolution).
+// Each power-of-two range is split into SUB_BUCKETS linear buckets, so the
+// relative error stays below 1/SUB_BUCKETS across the whole range.
+class LatencyHistogram {
+public:
+    static constexpr std::size_t SUB_BUCKET_BITS = 4;
+    static constexpr std::size_t SUB_BUCKETS = std::size_t{1} << SUB_BUCKET_BITS;
+    static constexpr std::size_t RANGES = 32;   // up to ~2^32 us, far beyond any sane RTT
+    static constexpr std::size_t BUCKET_COUNT = SUB_BUCKETS * RANGES;
+
+    void record(std::uint64_t micros) {
+        buckets_[indexOf(micros)].fetch_add(1, std::memory_order_relaxed);
+        count_.fetch_add(1, std::memory_order_relaxed);
+
+        std::uint64_t seen = max_.load(std::memory_order_relaxed);
+        while (micros > seen && !max_.compare_exchange_weak(seen, micros, std::memory_order_relaxed)) {
+        }
+    }
+
+    std::uint64_t count() const { return count_.load(std::memory_order_relaxed); }
+    std::uint64_t max() const { return max_.load(std::memory_order_relaxed); }
+
+    // Upper bound of the bucket holding the p-th fraction of samples
+    std::uint64_t percentile(double p) const {
+        const std::uint64_t total = count();
+        if (total == 0) {
+            return 0;
+        }
+        const auto target = static_cast<std::uint64_t>(p * static_cast<double>(total - 1)) + 1;
+        std::uint64_t seen = 0;
+        for (std::size_t i = 0; i < BUCKET_COUNT; ++i) {
+            seen += buckets_[i].load(std::memory_order_relaxed);
+            if (seen >= target) {
+                return upperBoundOf(i);
+            }
+        }
+        return max();
+    }
+
+    // Non-empty buckets as JSON: [[upper_us, count], ...]
+    void writeBucketsJson(std::ostream& os) const {
+        os << '[';
+        bool first = true;
+        for (std::size_t i = 0; i < BUCKET_COUNT; ++i) {
+            auto n = buckets_[i].load(std::memory_order_relaxed);
+            if (n == 0) {
+                continue;
+            }
+            os << (first ? "" : ", ") << '[' << upperBoundOf(i) << ", " << n << ']';
+            first = false;
+        }
+        os << ']';
+    }
+
+private:
+    std::array<std::atomic<std::uint64_t>, BUCKET_COUNT> buckets_{};
+    std::atomic<std::uint64_t> count_{0};
+    std::atomic<std::uint64_t> max_{0};
+
+    static std::size_t indexOf(std::uint64_t micros) {
+        if (micros < SUB_BUCKETS) {
+            return static_cast<std::size_t>(micros);   // range 0 is exact
+        }
+        // Keep the top log2(SUB_BUCKETS)+1 bits: the leading one selects the range,
+        // the bits below it the linear sub-bucket
+        const std::size_t shift = static_cast<std::size_t>(63 - __builtin_clzll(micros)) - SUB_BUCKET_BITS;
+        const std::size_t range = shift + 1;
+        if (range >= RANGES) {
+            return BUCKET_COUNT - 1;
+        }
+        const std::size_t sub = static_cast<std::size_t>(micros >> shift) - SUB_BUCKETS;
+        return range * SUB_BUCKETS + sub;
+    }
+
+    static std::uint64_t upperBoundOf(std::size_t index) {
+        const std::size_t range = index / SUB_BUCKETS;
+        const std::size_t sub = index % SUB_BUCKETS;
+        if (range == 0) {
+            return sub;
+        }
+        return ((static_cast<std::uint64_t>(SUB_BUCKETS + sub) + 1) << (range - 1)) - 1;
+    }
+};
@@ -0,0 +1,238 @@
+#pragma once
+
+#include "LatencyHistogram.hpp"
+#include <vsomeip/vsomeip.hpp>
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <semaphore>
+#include <thread>
+#include <vector>
+
+// Open-loop SOME/IP load generator for SomeIPTestServer.
+// Sends requests at a fixed rate with at most 'concurrency' outstanding, and
+// records request->response round-trip time in a LatencyHistogram.
+// Each request carries a 64-bit id that the server echoes back, which is how
+// responses are matched to their send time. Every response frees its window slot,
+// errors included; only matched OK responses are timed.
+class SomeIPLoadClient {
+public:
+    static constexpr std::size_t MAX_CONCURRENCY = 4096;
+
+    struct Options {
+        std::size_t rate = 1000;              // requests per second
+        std::size_t concurrency = 16;         // max outstanding requests
+        std::size_t payloadSize = 8;          // request payload bytes (>= 8 for the id)
+        std::chrono::seconds duration{10};
+    };
+
+    struct Result {
+        std::uint64_t sent = 0;
+        std::uint64_t received = 0;
+        std::uint64_t windowStalls = 0;       // send slots lost waiting for the window
+        std::uint64_t errors = 0;             // non-OK or truncated responses
+        std::uint64_t late = 0;               // answered after their send-time slot was reused
+        std::chrono::nanoseconds elapsed{0};
+    };
+
+    SomeIPLoadClient()
+        : app_(vsomeip::runtime::get()->create_application("TelemetryLoadClient")) {
+        for (auto& id : sendIds_) {
+            id.store(NO_REQUEST, std::memory_order_relaxed);
+        }
+    }
+
+    ~SomeIPLoadClient() {
+        stop();
+    }
+
+    // Non-copyable, non-movable
+    SomeIPLoadClient(const SomeIPLoadClient&) = delete;
+    SomeIPLoadClient& operator=(const SomeIPLoadClient&) = delete;
+    SomeIPLoadClient(SomeIPLoadClient&&) = delete;
+    SomeIPLoadClient& operator=(SomeIPLoadClient&&) = delete;
+
+    bool start() {
+        if (isRunning_) {
+            return true;
+        }
+        if (!app_->init()) {
+            return false;
+        }
+
+        app_->register_state_handler([this](vsomeip::state_type_e state) {
+            if (state == vsomeip::state_type_e::ST_REGISTERED) {
+                app_->request_service(SERVICE_ID, INSTANCE_ID, MAJOR_VERSION, MINOR_VERSION);
+            }
+        });
+        app_->register_availability_handler(SERVICE_ID, INSTANCE_ID,
+            [this](vsomeip::service_t, vsomeip::instance_t, bool available) {
+                std::lock_guard<std::mutex> lock(availableMutex_);
+                isAvailable_ = available;
+                availableCV_.notify_all();
+            });
+        app_->register_message_handler(SERVICE_ID, INSTANCE_ID, METHOD_ID,
+            [this](const std::shared_ptr<vsomeip::message>& response) { onResponse(response); });
+
+        isRunning_ = true;
+        runnerThread_ = std::thread([this]() { app_->start(); });
+        return true;
+    }
+
+    void stop() {
+        if (!isRunning_) {
+            return;
+        }
+        isRunning_ = false;
+        app_->release_service(SERVICE_ID, INSTANCE_ID);
+        app_->unregister_message_handler(SERVICE_ID, INSTANCE_ID, METHOD_ID);
+        app_->unregister_availability_handler(SERVICE_ID, INSTANCE_ID);
+        app_->unregister_state_handler();
+        app_->stop();
+        if (runnerThread_.joinable()) {
+            runnerThread_.join();
+        }
+    }
+
+    bool waitForService(std::chrono::seconds timeout) {
+        std::unique_lock<std::mutex> lock(availableMutex_);
+        return availableCV_.wait_for(lock, timeout, [this]() { return isAvailable_; });
+    }
+
+    Result run(const Options& options) {
+        const std::size_t window = std::clamp<std::size_t>(options.concurrency, 1, MAX_CONCURRENCY);
+        const std::size_t payloadSize = std::max<std::size_t>(options.payloadSize, sizeof(std::uint64_t));
+        const auto interval = std::chrono::nanoseconds(1'000'000'000 / std::max<std::size_t>(options.rate, 1));
+
+        // Responses to an earlier run may still release: start from an empty window
+        while (slots_.try_acquire()) {
+        }
+        slots_.release(static_cast<std::ptrdiff_t>(window));
+        received_ = 0;
+        errors_ = 0;
+        late_ = 0;
+
+        std::vector<vsomeip::byte_t> body(payloadSize, 0);
+        Result result;
+        const auto start = Clock::now();
+        const auto end = start + options.duration;
+        auto nextSend = start;
+
+        for (std::uint64_t id = 0; Clock::now() < end; ++id) {
+            // Pace on a fixed schedule (open loop): a slow response delays
+            // sending only once the window is exhausted
+            std::this_thread::sleep_until(nextSend);
+            nextSend += interval;
+
+            if (!slots_.try_acquire_for(std::chrono::seconds(1))) {
+                ++result.windowStalls;
+                continue;
+            }
+
+            std::memcpy(body.data(), &id, sizeof(id));
+            auto request = vsomeip::runtime::get()->create_request();
+            request->set_service(SERVICE_ID);
+            request->set_instance(INSTANCE_ID);
+            request->set_method(METHOD_ID);
+            request->set_interface_version(MAJOR_VERSION);
+            auto payload = vsomeip::runtime::get()->create_payload();
+            payload->set_data(body.data(), static_cast<vsomeip::length_t>(body.size()));
+            request->set_payload(payload);
+
+            // Retire the slot's old id first (acq_rel orders it after a response's claim),
+            // publish the new id last, so a response that finds its id finds its send time
+            auto& slotId = sendIds_[id % MAX_CONCURRENCY];
+            slotId.exchange(NO_REQUEST, std::memory_order_acq_rel);
+            sendTimes_[id % MAX_CONCURRENCY].store(nowNs(), std::memory_order_relaxed);
+            slotId.store(id, std::memory_order_release);
+            app_->send(request);
+            ++result.sent;
+        }
+
+        // Give stragglers a moment, then stop counting
+        for (std::size_t i = 0; i < window; ++i) {
+            (void)slots_.try_acquire_for(std::chrono::milliseconds(100));
+        }
+        result.elapsed = Clock::now() - start;
+        result.received = received_.load();
+        result.errors = errors_.load();
+        result.late = late_.load();
+        return result;
+    }
+
+    const LatencyHistogram& histogram() const { return histogram_; }
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    static std::int64_t nowNs() {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now().time_since_epoch()).count();
+    }
+
+    void onResponse(const std::shared_ptr<vsomeip::message>& response) {
+        record(response);
+        slots_.release();   // whatever the outcome, this request is no longer outstanding
+    }
+
+    void record(const std::shared_ptr<vsomeip::message>& response) {
+        auto payload = response->get_payload();
+        if (response->get_return_code() != vsomeip::return_code_e::E_OK ||
+            !payload || payload->get_length() < sizeof(float) + sizeof(std::uint64_t)) {
+            errors_.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+
+        std::uint64_t id = 0;
+        std::memcpy(&id, payload->get_data() + sizeof(float), sizeof(id));
+        auto& slotId = sendIds_[id % MAX_CONCURRENCY];
+        // Read the time before claiming the slot: if the claim succeeds, run() had not
+        // yet started to reuse it, so the time is this request's
+        if (slotId.load(std::memory_order_acquire) != id) {
+            late_.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+        const std::int64_t sentAt = sendTimes_[id % MAX_CONCURRENCY].load(std::memory_order_relaxed);
+        std::uint64_t expected = id;
+        if (!slotId.compare_exchange_strong(expected, NO_REQUEST, std::memory_order_acq_rel)) {
+            late_.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+        histogram_.record(static_cast<std::uint64_t>(std::max<std::int64_t>(nowNs() - sentAt, 0) / 1000));
+        received_.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    std::shared_ptr<vsomeip::application> app_;
+    std::thread runnerThread_;
+    std::atomic<bool> isRunning_{false};
+
+    std::mutex availableMutex_;
+    std::condition_variable availableCV_;
+    bool isAvailable_{false};
+
+    static constexpr std::uint64_t NO_REQUEST = UINT64_MAX;
+
+    // Indexed by request id modulo MAX_CONCURRENCY. Stalls advance the id without
+    // sending, so a slot can be reused while its request is still out; 'sendIds_'
+    // tells a late response apart from the one now using the slot.
+    std::array<std::atomic<std::int64_t>, MAX_CONCURRENCY> sendTimes_{};
+    std::array<std::atomic<std::uint64_t>, MAX_CONCURRENCY> sendIds_{};
+    // Window of outstanding requests; a member, so a response handled after run()
+    // returned still releases into live memory
+    std::counting_semaphore<> slots_{0};
+    std::atomic<std::uint64_t> received_{0};
+    std::atomic<std::uint64_t> errors_{0};
+    std::atomic<std::uint64_t> late_{0};
+    LatencyHistogram histogram_;
+
+    // Must match server IDs
+    static constexpr vsomeip::service_t SERVICE_ID = 0x1234;
+    static constexpr vsomeip::instance_t INSTANCE_ID = 0x5678;
+    static constexpr vsomeip::method_t METHOD_ID = 0x0001;
+    static constexpr vsomeip::major_version_t MAJOR_VERSION = 1;
+    static constexpr vsomeip::minor_version_t MINOR_VERSION = 0;
+};
@@ -106,10 +106,20 @@ private:
         auto response = vsomeip::runtime::get()->create_response(request);
         auto payload = vsomeip::runtime::get()->create_payload();
         
-        // Serialize load value into payload
-        std::vector<vsomeip::byte_t> data(sizeof(float));
-        std::memcpy(data.data(), &loadValue, sizeof(float));
-        payload->set_data(data);
+        // Response layout: [float load][echo of the request payload].
+        // Plain clients send an empty request and get just the float; the load
+        // generator tags requests with an id and reads it back from the echo.
+        // The scratch buffer is reused across responses instead of a fresh vector each time.
+        const auto requestPayload = request->get_payload();
+        const vsomeip::length_t echoLength = requestPayload ? requestPayload->get_length() : 0;
+        thread_local std::vector<vsomeip::byte_t> scratch;
+        scratch.resize(sizeof(float) + echoLength);
+
+        std::memcpy(scratch.data(), &loadValue, sizeof(float));
+        if (echoLength > 0) {
+            std::memcpy(scratch.data() + sizeof(float), requestPayload->get_data(), echoLength);
+        }
+        payload->set_data(scratch.data(), static_cast<vsomeip::length_t>(scratch.size()));
         response->set_payload(payload);
         
         // Send response
@@ -0,0 +1,148 @@
+// Kills producer processes in the middle of a ShmRing push and checks the collector
+// side never wedges. Each child pushes a random number of records, then pushes one whose
+// payload sits on a page it made unreadable: the copy into the slot faults after the
+// slot was claimed, so the child dies holding an unpublished slot. After every round
+// the ring must drain back to empty (skipping that slot), and at the end it must still
+// carry records end to end. Every other child pushes through a producer the parent
+// attached before fork(), which must stamp the child's pid, not the parent's.
+//
+//   shm_ring_abandon_test [rounds]
+
+#include "concurrency/ShmRing.hpp"
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <string>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+const std::string RING_NAME = "/shm_ring_abandon_test." + std::to_string(::getpid());
+constexpr std::size_t CAPACITY = 64;
+
+[[noreturn]] void pushThenDieMidPush(ShmRing *ring, unsigned records) {
+    const LogMessage msg(TelemetrySrc::CPU, SeverityLvl::INFO, "2024-01-01 00:00:00", "abandon test record");
+    for (unsigned i = 0; i < records;) {
+        // Stay below full so the record is really pushed, not rejected
+        if (ring->size() < CAPACITY / 2 && ring->tryPush(msg)) {
+            ++i;
+        }
+    }
+
+    const LogMessage poisoned(TelemetrySrc::CPU, SeverityLvl::INFO, "2024-01-01 00:00:00", std::string(8192, 'x'));
+    const auto pageSize = static_cast<std::uintptr_t>(::sysconf(_SC_PAGESIZE));
+    const auto page = reinterpret_cast<std::uintptr_t>(poisoned.getPayload().data()) & ~(pageSize - 1);
+    ::mprotect(reinterpret_cast<void *>(page), pageSize, PROT_NONE);
+    while (ring->size() >= CAPACITY / 2) {
+    }
+    (void)ring->tryPush(poisoned);  // claims a slot, then faults copying the payload
+    std::_Exit(3);
+}
+
+// Pops until the ring is empty; false if it stays non-empty past the deadline
+bool drainToEmpty(ShmRing &ring, std::chrono::milliseconds limit) {
+    const auto deadline = Clock::now() + limit;
+    while (Clock::now() < deadline) {
+        while (ring.tryPop()) {
+        }
+        if (ring.size() == 0) {
+            return true;
+        }
+        ring.waitForData(std::chrono::milliseconds(1));
+    }
+    return false;
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+    const int rounds = argc > 1 ? std::atoi(argv[1]) : 100;
+
+    ShmRing::unlink(RING_NAME);
+    auto ring = ShmRing::create(RING_NAME, CAPACITY);
+    if (!ring) {
+        std::cerr << "Failed to create the ring" << std::endl;
+        return 1;
+    }
+
+    // Attached before any fork, as a process that forks after ShmLogProducer::connect() would
+    auto inherited = ShmRing::attach(RING_NAME);
+    if (!inherited) {
+        std::cerr << "Failed to attach to the ring" << std::endl;
+        return 1;
+    }
+
+    std::mt19937 rng(std::random_device{}());
+    std::uniform_int_distribution<unsigned> records(0, 3 * CAPACITY);  // wraps the ring a few times
+    int result = 0;
+    int round = 0;
+    for (; round < rounds && result == 0; ++round) {
+        const unsigned count = records(rng);
+        const pid_t child = ::fork();
+        if (child < 0) {
+            std::cerr << "fork failed" << std::endl;
+            result = 1;
+            break;
+        }
+        if (child == 0) {
+            if (round % 2 == 0) {
+                pushThenDieMidPush(&*inherited, count);
+            }
+            auto own = ShmRing::attach(RING_NAME);
+            if (!own) {
+                std::_Exit(2);
+            }
+            pushThenDieMidPush(&*own, count);
+        }
+
+        // Drain while the child pushes, until it has died
+        int status = 0;
+        while (::waitpid(child, &status, WNOHANG) == 0) {
+            (void)ring->tryPop();
+        }
+        if (WIFEXITED(status) && WEXITSTATUS(status) != 0) {
+            std::cerr << "Round " << round << ": producer exited with " << WEXITSTATUS(status)
+                      << " instead of dying mid-push" << std::endl;
+            result = 1;
+        } else if (!drainToEmpty(*ring, std::chrono::seconds(2))) {
+            std::cerr << "Round " << round << ": ring wedged with " << ring->size() << " records" << std::endl;
+            result = 1;
+        }
+    }
+
+    if (result == 0 && ring->abandoned() != static_cast<std::uint64_t>(rounds)) {
+        std::cerr << "Reclaimed " << ring->abandoned() << " slots for " << rounds << " dead producers" << std::endl;
+        result = 1;
+    }
+
+    // The ring must still work end to end after all that
+    if (result == 0) {
+        const LogMessage msg(TelemetrySrc::CPU, SeverityLvl::INFO, "2024-01-01 00:00:00", "after");
+        for (std::size_t i = 0; i < CAPACITY; ++i) {
+            if (!ring->tryPush(msg)) {
+                std::cerr << "Push " << i << " failed after the kills" << std::endl;
+                result = 1;
+                break;
+            }
+        }
+        std::size_t popped = 0;
+        while (ring->tryPop()) {
+            ++popped;
+        }
+        if (result == 0 && popped != CAPACITY) {
+            std::cerr << "Popped " << popped << " of " << CAPACITY << " records" << std::endl;
+            result = 1;
+        }
+    }
+
+    std::cout << (result == 0 ? "PASS" : "FAIL") << ": " << round << " producers died mid-push, "
+              << ring->abandoned() << " claimed slots reclaimed" << std::endl;
+    ShmRing::unlink(RING_NAME);
+    return result;
+}
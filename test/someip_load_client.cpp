@@ -0,0 +1,67 @@
+#include "SomeIPLoadClient.hpp"
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+
+// Drives SomeIPTestServer at a fixed request rate and prints the round-trip
+// latency distribution as JSON, to size SomeIP polling rates against ECU capacity.
+//
+//   someip_load_client [--rate N] [--concurrency N] [--payload BYTES] [--seconds N]
+
+namespace {
+std::size_t argOr(int argc, char** argv, const char* flag, std::size_t fallback) {
+    for (int i = 1; i + 1 < argc; ++i) {
+        if (std::strcmp(argv[i], flag) == 0) {
+            return static_cast<std::size_t>(std::strtoull(argv[i + 1], nullptr, 10));
+        }
+    }
+    return fallback;
+}
+}
+
+int main(int argc, char** argv) {
+    SomeIPLoadClient::Options options;
+    options.rate = argOr(argc, argv, "--rate", options.rate);
+    options.concurrency = argOr(argc, argv, "--concurrency", options.concurrency);
+    options.payloadSize = argOr(argc, argv, "--payload", options.payloadSize);
+    options.duration = std::chrono::seconds(argOr(argc, argv, "--seconds", options.duration.count()));
+
+    std::cerr << "=== SomeIP Load Generator ===" << std::endl;
+    std::cerr << "rate=" << options.rate << "/s concurrency=" << options.concurrency
+              << " payload=" << options.payloadSize << "B duration=" << options.duration.count() << "s" << std::endl;
+
+    SomeIPLoadClient client;
+    if (!client.start()) {
+        std::cerr << "Failed to initialize SomeIP load client!" << std::endl;
+        return 1;
+    }
+    if (!client.waitForService(std::chrono::seconds(10))) {
+        std::cerr << "Server not available (is someip_test_server running?)" << std::endl;
+        return 1;
+    }
+
+    const auto result = client.run(options);
+    const auto& histogram = client.histogram();
+    const double seconds = std::chrono::duration<double>(result.elapsed).count();
+
+    std::cout << "{\"rate\": " << options.rate
+              << ", \"concurrency\": " << options.concurrency
+              << ", \"payload_bytes\": " << options.payloadSize
+              << ", \"sent\": " << result.sent
+              << ", \"received\": " << result.received
+              << ", \"window_stalls\": " << result.windowStalls
+              << ", \"errors\": " << result.errors
+              << ", \"late\": " << result.late
+              << ", \"achieved_rps\": " << (seconds > 0 ? static_cast<double>(result.received) / seconds : 0.0)
+              << ", \"rtt_us\": {\"p50\": " << histogram.percentile(0.50)
+              << ", \"p90\": " << histogram.percentile(0.90)
+              << ", \"p99\": " << histogram.percentile(0.99)
+              << ", \"p999\": " << histogram.percentile(0.999)
+              << ", \"max\": " << histogram.max() << "}"
+              << ", \"histogram_us\": ";
+    histogram.writeBucketsJson(std::cout);
+    std::cout << "}" << std::endl;
+
+    client.stop();
+    return 0;
+}